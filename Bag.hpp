@@ -3,6 +3,7 @@
 
 #include <string>                   // std::string
 #include <sstream>                  // std::stringstream
+#include <memory>                   // std::allocator, std::allocator_traits
 #include <boost/lexical_cast.hpp>   // boost::lexical_cast
 
 /**
@@ -11,6 +12,9 @@
  *  items in arbitrary order.
  *
  *  This implementation uses a singly linked list with a nested class Node.
+ *  Nodes are obtained from the allocator parameter, rebound to the node type;
+ *  use {@code PoolAllocator} to draw them from contiguous recycled chunks
+ *  instead of a heap allocation per item.
  *
  *  @author Benjamin Chan
  *
@@ -21,8 +25,9 @@
  *  https://algs4.cs.princeton.edu/13stacks/Bag.java.html
  *
  *  @param <T> the generic type of an item in this bag
+ *  @param <Allocator> the allocator from which nodes are obtained
  */
-template<typename T>
+template<typename T, typename Allocator = std::allocator<T>>
 class Bag {
     /**
      * @def the helper inner linked list class for a queue
@@ -33,20 +38,22 @@ public:
     /// Initializes an empty bag
     Bag() : n(0), first(nullptr), last(nullptr) {};
 
+    /// Initializes an empty bag whose nodes are obtained from the given allocator
+    explicit Bag(const Allocator &alloc) : n(0), first(nullptr), last(nullptr), nodeAllocator(alloc) {};
+
     /// Prohibits construction from an lvalue bag
-    Bag(const Bag<T> &other) = delete;
+    Bag(const Bag<T, Allocator> &other) = delete;
 
     /// Prohibits construction from an rvalue bag
-    Bag(Bag<T> &&other) = delete;
+    Bag(Bag<T, Allocator> &&other) = delete;
 
     /// Destructor deletes all allocated items of a bag
     ~Bag() {
-        while (first->next != nullptr) {
+        while (first != nullptr) {
             Node *temp = first;
             first = first->next;
-            delete temp;
+            destroyNode(temp);
         }
-        delete first;
     };
 
     /**
@@ -84,7 +91,7 @@ public:
 
     /// Nested iterator class
     class Iterator {
-        friend class Bag<T>;
+        friend class Bag<T, Allocator>;
 
     private:
         Node *nodePtr;
@@ -135,7 +142,7 @@ public:
      * @return an iterator that points to the past-the-end node after the last node of the bag
      */
     inline Iterator end() const {
-        return Iterator(last->next);
+        return Iterator(nullptr);
     }
 
 private:
@@ -160,24 +167,44 @@ private:
 
     /// the last node in a bag
     Node *last;
+
+    /// the allocator rebound to the node type
+    using NodeAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+    using NodeTraits = std::allocator_traits<NodeAllocator>;
+
+    /// the allocator from which nodes are obtained
+    NodeAllocator nodeAllocator;
+
+    /// allocates and constructs a node
+    template<typename... Args>
+    Node *createNode(Args &&... args) {
+        Node *node = NodeTraits::allocate(nodeAllocator, 1);
+        return ::new(static_cast<void *>(node)) Node(std::forward<Args>(args)...);
+    }
+
+    /// destroys and deallocates a node
+    void destroyNode(Node *node) {
+        node->~Node();
+        NodeTraits::deallocate(nodeAllocator, node, 1);
+    }
 };
 
-template<typename T>
-void Bag<T>::add(T item) {
+template<typename T, typename Allocator>
+void Bag<T, Allocator>::add(T item) {
     if (isEmpty()) {
-        last = new Node();
+        last = createNode();
         first = last;
         first->item = item;
         n++;
         return;
     }
     Node *oldFirst = first;
-    first = new Node(item, oldFirst);
+    first = createNode(item, oldFirst);
     n++;
 }
 
-template<typename T>
-std::string Bag<T>::toString() const {
+template<typename T, typename Allocator>
+std::string Bag<T, Allocator>::toString() const {
     std::stringstream ss;
     for (const auto &item: *this) {
         ss << boost::lexical_cast<std::string>(item) << " ";
@@ -187,8 +214,8 @@ std::string Bag<T>::toString() const {
 }
 
 /// Overloads the "<<" operator for a bag
-template<typename T>
-std::ostream &operator<<(std::ostream &os, const Bag<T> &bag) {
+template<typename T, typename Allocator>
+std::ostream &operator<<(std::ostream &os, const Bag<T, Allocator> &bag) {
     return os << bag.toString();
 }
 
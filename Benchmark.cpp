@@ -0,0 +1,1163 @@
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <sstream>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <vector>
+#include <unistd.h>
+#include "Bag.hpp"
+#include "Queue.hpp"
+#include "ResizingArrayQueue.hpp"
+#include "ConcurrentQueue.hpp"
+#include "Stack.hpp"
+#include "PoolAllocator.hpp"
+#include "WeightedQuickUnionUF.hpp"
+#include "ConcurrentUF.hpp"
+#include "ThreadPool.hpp"
+#include "In.hpp"
+#include "SelectionSort.hpp"
+#include "InsertionSort.hpp"
+#include "ShellSort.hpp"
+#include "MergeSort.hpp"
+#include "MergeSortBU.hpp"
+#include "QuickSort.hpp"
+#include "QuickSort3way.hpp"
+#include "QuickSelect.hpp"
+#include "BinarySearch.hpp"
+#include "EytzingerIndex.hpp"
+#include "LearnedIndex.hpp"
+#include "LSD.hpp"
+#include "MSD.hpp"
+#include "Quick3string.hpp"
+#include "ExternalSort.hpp"
+#include "MaxPQ.hpp"
+#include "MinPQ.hpp"
+#include "IndexMinPQ.hpp"
+#include "PairingHeap.hpp"
+#include "RadixHeap.hpp"
+#include "ConcurrentMinPQ.hpp"
+#include "TopK.hpp"
+#include "QuantileSketch.hpp"
+
+using namespace std;
+using namespace std::chrono;
+
+/***************************************************************************
+ * Usage: Benchmark [--sizes 1e3,1e4,...] [--reps 7] [--warmup 2]
+ *                  [--filter text] [--format table|csv|json] [--out file]
+ *
+ * Every case is run on every size up to its own maximum and on every input
+ * distribution it accepts. A run times only the work of the case: the input
+ * is copied and any setup is done beforehand. After the warm-up runs, the
+ * median, 99th percentile and minimum time per element of the measured runs
+ * are reported, so that results can be compared between changes.
+ ***************************************************************************/
+
+/// the shapes of generated input
+enum class Distribution {
+    Random, Sorted, Reverse, FewUnique, OrganPipe, SortedTail
+};
+
+static const vector<Distribution> ALL_DISTRIBUTIONS = {
+        Distribution::Random, Distribution::Sorted, Distribution::Reverse,
+        Distribution::FewUnique, Distribution::OrganPipe, Distribution::SortedTail
+};
+
+static const vector<Distribution> RANDOM_ONLY = {Distribution::Random};
+
+static string nameOf(Distribution distribution) {
+    switch (distribution) {
+        case Distribution::Random:
+            return "random";
+        case Distribution::Sorted:
+            return "sorted";
+        case Distribution::Reverse:
+            return "reverse";
+        case Distribution::FewUnique:
+            return "few-unique";
+        case Distribution::OrganPipe:
+            return "organ-pipe";
+        case Distribution::SortedTail:
+            return "sorted-tail";
+    }
+    return "";
+}
+
+// generates n keys of the given distribution; the same arguments give the same keys
+static vector<int> generate(Distribution distribution, long n, unsigned int seed = 2021) {
+    vector<int> keys(n);
+    mt19937 g(seed);
+    switch (distribution) {
+        case Distribution::Random:
+            for (auto &key: keys) key = (int) (g() >> 1);
+            break;
+        case Distribution::Sorted:
+            for (long i = 0; i < n; i++) keys[i] = (int) i;
+            break;
+        case Distribution::Reverse:
+            for (long i = 0; i < n; i++) keys[i] = (int) (n - 1 - i);
+            break;
+        case Distribution::FewUnique:
+            for (auto &key: keys) key = (int) (g() % 16);
+            break;
+        case Distribution::OrganPipe:
+            for (long i = 0; i < n; i++) keys[i] = (int) min(i, n - 1 - i);
+            break;
+        case Distribution::SortedTail:
+            // sorted, with a random tenth appended, like a log that has had new entries appended
+            for (long i = 0; i < n; i++) keys[i] = i < n - n / 10 ? (int) i : (int) (g() % n);
+            break;
+    }
+    return keys;
+}
+
+/// the work of a case; prepare() does all untimed setup and returns the work to be timed
+using Prepare = function<function<void()>(const vector<int> &)>;
+
+/// a benchmark case, run on inputs of at most maxSize elements of the given distributions
+struct Case {
+    string group;
+    string name;
+    long maxSize;
+    vector<Distribution> distributions;
+    Prepare prepare;
+};
+
+/// the summary of the measured runs of a case on one input
+struct Result {
+    string group;
+    string name;
+    string distribution;
+    long n;
+    int reps;
+    double median;
+    double p99;
+    double min;
+};
+
+struct Options {
+    vector<long> sizes = {1000, 10000, 100000, 1000000};
+    int reps = 7;
+    int warmup = 2;
+    string filter;
+    string format = "table";
+    string out;
+};
+
+static constexpr long UNLIMITED = 100000000;
+
+static vector<Case> cases;
+
+static void add(const string &group, const string &name, long maxSize, const vector<Distribution> &distributions,
+                Prepare prepare) {
+    cases.push_back({group, name, maxSize, distributions, move(prepare)});
+}
+
+// the pool shared by the parallel cases
+static ThreadPool &pool() {
+    static ThreadPool instance;
+    return instance;
+}
+
+// a file written from an input, which is removed with the files derived from it when it is replaced or the
+// benchmark exits
+struct InputFile {
+    string path;
+    vector<string> outputs;
+
+    ~InputFile() {
+        error_code ignored;
+        filesystem::remove(path, ignored);
+        for (const string &output: outputs) filesystem::remove(output, ignored);
+    }
+};
+
+// the file of the given kind written from the input, reused by the repetitions of a case; it is named for a hash
+// of the input, so that a file is never reused for a different input
+static shared_ptr<InputFile> inputFile(const string &kind, const string &extension, const vector<int> &input,
+                                       const function<void(const string &)> &write) {
+    static map<string, shared_ptr<InputFile>> files;
+    uint64_t hash = 0xCBF29CE484222325ull;
+    for (int x: input) hash = (hash ^ (uint32_t) x) * 0x100000001B3ull;
+    string name = "algorithms_benchmark_" + kind + "_" + to_string(getpid()) + "_" + to_string(input.size()) + "_"
+                  + to_string(hash) + extension;
+    string path = (filesystem::temp_directory_path() / name).string();
+    shared_ptr<InputFile> &file = files[kind];
+    if (!file || file->path != path) {
+        file = make_shared<InputFile>();
+        file->path = path;
+        write(path);
+    }
+    return file;
+}
+
+// prevents the compiler from discarding a result: the empty assembly claims to read it
+template<typename T>
+static void keep(const T &value) {
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+/***************************************************************************
+ * Sorts
+ ***************************************************************************/
+
+// sorts a fresh copy of the input with the given sort
+template<template<typename> class Sort>
+static Prepare sortCase() {
+    return [](const vector<int> &input) {
+        auto data = make_shared<vector<int>>(input);
+        return function<void()>([data] { Sort<int>{span<int>(*data)}; });
+    };
+}
+
+// sorts a fresh copy of the input with the given merge sort in its memory-bounded mode, through a
+// scratch buffer of the given length, which is allocated before the timed work
+template<template<typename> class Sort>
+static Prepare boundedSortCase(function<long(long)> bufferLength) {
+    return [bufferLength](const vector<int> &input) {
+        auto data = make_shared<vector<int>>(input);
+        auto buffer = make_shared<vector<int>>(bufferLength((long) input.size()));
+        return function<void()>([data, buffer] { Sort<int>{span<int>(*data), span<int>(*buffer)}; });
+    };
+}
+
+// spells every key as a 7-letter lowercase word, so the words have the order and repetitions of the keys
+static shared_ptr<vector<string>> words(const vector<int> &input) {
+    auto data = make_shared<vector<string>>(input.size());
+    for (size_t i = 0; i < input.size(); i++) {
+        string word(7, 'a');
+        for (int j = 6, key = input[i]; j >= 0; j--, key /= 26) word[j] = (char) ('a' + key % 26);
+        (*data)[i] = word;
+    }
+    return data;
+}
+
+// sorts a fresh copy of the input, spelled as words, with the given string sort
+template<template<typename> class Sort>
+static Prepare stringSortCase() {
+    return [](const vector<int> &input) {
+        auto data = words(input);
+        return function<void()>([data] { Sort<string>{span<string>(*data)}; });
+    };
+}
+
+static void addSorts() {
+    add("sort", "SelectionSort", 10000, ALL_DISTRIBUTIONS, sortCase<SelectionSort>());
+    add("sort", "InsertionSort", 10000, ALL_DISTRIBUTIONS, sortCase<InsertionSort>());
+    add("sort", "ShellSort", UNLIMITED, ALL_DISTRIBUTIONS, sortCase<ShellSort>());
+    add("sort", "MergeSort", UNLIMITED, ALL_DISTRIBUTIONS, sortCase<MergeSort>());
+    add("sort", "MergeSort parallel", UNLIMITED, ALL_DISTRIBUTIONS, [](const vector<int> &input) {
+        auto data = make_shared<vector<int>>(input);
+        return function<void()>([data] { MergeSort<int>{span<int>(*data), pool()}; });
+    });
+    add("sort", "MergeSortBU", UNLIMITED, ALL_DISTRIBUTIONS, sortCase<MergeSortBU>());
+    for (auto [name, length]: vector<pair<string, function<long(long)>>>{
+            {"0", [](long) { return 0L; }},
+            {"sqrt(n)", [](long n) { return (long) sqrt((double) n); }},
+            {"n/16", [](long n) { return n / 16; }},
+            {"n/2", [](long n) { return n / 2; }}}) {
+        add("sort", "MergeSort buffer " + name, UNLIMITED, RANDOM_ONLY, boundedSortCase<MergeSort>(length));
+        add("sort", "MergeSortBU buffer " + name, UNLIMITED, RANDOM_ONLY, boundedSortCase<MergeSortBU>(length));
+    }
+    add("sort", "MergeSortBU natural runs", UNLIMITED, ALL_DISTRIBUTIONS, [](const vector<int> &input) {
+        auto data = make_shared<vector<int>>(input);
+        return function<void()>([data] { MergeSortBU<int>{span<int>(*data), MergeSortBUMode::NaturalRuns}; });
+    });
+    add("sort", "QuickSort", UNLIMITED, ALL_DISTRIBUTIONS, sortCase<QuickSort>());
+    add("sort", "QuickSort introsort", UNLIMITED, ALL_DISTRIBUTIONS, [](const vector<int> &input) {
+        auto data = make_shared<vector<int>>(input);
+        return function<void()>([data] { QuickSort<int>{span<int>(*data), QuickSortMode::Introsort}; });
+    });
+    add("sort", "QuickSort block introsort", UNLIMITED, ALL_DISTRIBUTIONS, [](const vector<int> &input) {
+        auto data = make_shared<vector<int>>(input);
+        return function<void()>([data] { QuickSort<int>{span<int>(*data), QuickSortMode::BlockIntrosort}; });
+    });
+    add("sort", "QuickSort3way", UNLIMITED, ALL_DISTRIBUTIONS, sortCase<QuickSort3way>());
+    add("sort", "LSD", UNLIMITED, ALL_DISTRIBUTIONS, sortCase<LSD>());
+    add("string sort", "QuickSort3way", UNLIMITED, ALL_DISTRIBUTIONS, stringSortCase<QuickSort3way>());
+    add("string sort", "QuickSort block introsort", UNLIMITED, ALL_DISTRIBUTIONS, [](const vector<int> &input) {
+        auto data = words(input);
+        return function<void()>([data] { QuickSort<string>{span<string>(*data), QuickSortMode::BlockIntrosort}; });
+    });
+    add("string sort", "Quick3string", UNLIMITED, ALL_DISTRIBUTIONS, stringSortCase<Quick3string>());
+    add("string sort", "MSD", UNLIMITED, ALL_DISTRIBUTIONS, stringSortCase<MSD>());
+    add("sort", "LSD uint64_t", UNLIMITED, ALL_DISTRIBUTIONS, [](const vector<int> &input) {
+        auto data = make_shared<vector<uint64_t>>(input.begin(), input.end());
+        for (auto &x: *data) x = x << 32 | x;
+        return function<void()>([data] { LSD<uint64_t>{span<uint64_t>(*data)}; });
+    });
+    add("sort", "QuickSort block introsort uint64_t", UNLIMITED, ALL_DISTRIBUTIONS, [](const vector<int> &input) {
+        auto data = make_shared<vector<uint64_t>>(input.begin(), input.end());
+        for (auto &x: *data) x = x << 32 | x;
+        return function<void()>([data] {
+            QuickSort<uint64_t>{span<uint64_t>(*data), QuickSortMode::BlockIntrosort};
+        });
+    });
+}
+
+/***************************************************************************
+ * Selection
+ ***************************************************************************/
+
+// selects the median of a fresh copy of the input with the given mode
+template<typename Mode>
+static Prepare selectCase(Mode mode) {
+    return [mode](const vector<int> &input) {
+        auto data = make_shared<vector<int>>(input);
+        return function<void()>([data, mode] {
+            QuickSelect<int> select(span<int>(*data), mode);
+            keep(select.rankOf((int) data->size() / 2));
+        });
+    };
+}
+
+// selects the p50, p90, p99 and p99.9 of a fresh copy of the input, at once or one rank at a time
+static Prepare quantilesCase(bool together) {
+    return [together](const vector<int> &input) {
+        auto data = make_shared<vector<int>>(input);
+        return function<void()>([data, together] {
+            int n = (int) data->size();
+            vector<int> ranks = {n / 2, (int) (n * 0.9), (int) (n * 0.99), (int) (n * 0.999)};
+            QuickSelect<int> select(span<int>(*data), QuickSelectMode::FloydRivest);
+            if (together) {
+                keep(select.ranksOf(ranks).back());
+            } else {
+                for (int rank: ranks) keep(select.rankOf(rank));
+            }
+        });
+    };
+}
+
+static void addSelection() {
+    add("select", "QuickSelect", UNLIMITED, ALL_DISTRIBUTIONS, selectCase(QuickSortMode::Shuffled));
+    add("select", "QuickSelect introsort", UNLIMITED, ALL_DISTRIBUTIONS, selectCase(QuickSortMode::Introsort));
+    add("select", "QuickSelect block introsort", UNLIMITED, ALL_DISTRIBUTIONS,
+        selectCase(QuickSortMode::BlockIntrosort));
+    add("select", "QuickSelect Floyd-Rivest", UNLIMITED, ALL_DISTRIBUTIONS, selectCase(QuickSelectMode::FloydRivest));
+    add("select", "QuickSelect introselect", UNLIMITED, ALL_DISTRIBUTIONS, selectCase(QuickSelectMode::Introselect));
+    add("select", "4 quantiles rankOf each", UNLIMITED, ALL_DISTRIBUTIONS, quantilesCase(false));
+    add("select", "4 quantiles ranksOf", UNLIMITED, ALL_DISTRIBUTIONS, quantilesCase(true));
+    add("select", "QuickSelect partialSort 100", UNLIMITED, RANDOM_ONLY, [](const vector<int> &input) {
+        auto data = make_shared<vector<int>>(input);
+        return function<void()>([data] {
+            QuickSelect<int>(span<int>(*data), QuickSelectMode::FloydRivest).partialSort(min(100, (int) data->size()));
+        });
+    });
+    add("select", "std::partial_sort 100", UNLIMITED, RANDOM_ONLY, [](const vector<int> &input) {
+        auto data = make_shared<vector<int>>(input);
+        return function<void()>([data] {
+            partial_sort(data->begin(), data->begin() + min<size_t>(100, data->size()), data->end());
+        });
+    });
+}
+
+/***************************************************************************
+ * Search
+ ***************************************************************************/
+
+// looks up every key of the input in the sorted input with the search that build() makes from it beforehand
+template<typename Build>
+static Prepare searchCase(Build build) {
+    return [build](const vector<int> &input) {
+        auto table = make_shared<vector<int>>(input);
+        sort(table->begin(), table->end());
+        return function<void()>([&input, search = build(table)] {
+            long sum = 0;
+            for (int key: input) sum += search(key);
+            keep(sum);
+        });
+    };
+}
+
+// the keys of a sorted table of n keys of the given shape, in random order: uniform, lognormal (a few small keys
+// and a long tail) or clustered (a thousand tight groups)
+static shared_ptr<vector<int>> shapedKeys(const string &shape, long n) {
+    mt19937 g(2021);
+    auto keys = make_shared<vector<int>>(n);
+    lognormal_distribution<double> lognormal(0, 2);
+    normal_distribution<double> spread(0, 1000);
+    vector<double> centers(1000);
+    for (auto &center: centers) center = (double) (g() % 2000000000);
+    for (auto &key: *keys) {
+        double x;
+        if (shape == "uniform") x = (double) (g() % 2000000000);
+        else if (shape == "lognormal") x = min(2e9, lognormal(g) * 1e6);
+        else x = centers[g() % centers.size()] + spread(g);
+        key = (int) max(0.0, x);
+    }
+    return keys;
+}
+
+// looks up every key of a table of the given shape, of the size of the input, with the search that build() makes
+// from the sorted table beforehand
+template<typename Build>
+static Prepare shapedSearchCase(const string &shape, Build build) {
+    return [shape, build](const vector<int> &input) {
+        auto queries = shapedKeys(shape, (long) input.size());
+        auto table = make_shared<vector<int>>(*queries);
+        sort(table->begin(), table->end());
+        return function<void()>([queries, search = build(table)] {
+            long sum = 0;
+            for (int key: *queries) sum += search(key);
+            keep(sum);
+        });
+    };
+}
+
+static void addSearch() {
+    add("search", "BinarySearch indexOf", UNLIMITED, RANDOM_ONLY, searchCase([](shared_ptr<vector<int>> table) {
+        return [table](int key) { return BinarySearch::indexOf(span<int>(*table), key); };
+    }));
+    add("search", "std::lower_bound", UNLIMITED, RANDOM_ONLY, searchCase([](shared_ptr<vector<int>> table) {
+        return [table](int key) { return (int) (lower_bound(table->begin(), table->end(), key) - table->begin()); };
+    }));
+    add("search", "BinarySearch indexOfBatch", UNLIMITED, RANDOM_ONLY, [](const vector<int> &input) {
+        auto table = make_shared<vector<int>>(input);
+        sort(table->begin(), table->end());
+        auto out = make_shared<vector<int>>(input.size());
+        return function<void()>([&input, table, out] {
+            BinarySearch::indexOfBatch(span<const int>(*table), span<const int>(input), span<int>(*out));
+            keep((*out)[0]);
+        });
+    });
+    // the descending order takes the interleaved path without SIMD
+    add("search", "BinarySearch indexOfBatch reverse", UNLIMITED, RANDOM_ONLY, [](const vector<int> &input) {
+        auto table = make_shared<vector<int>>(input);
+        sort(table->begin(), table->end(), greater<int>());
+        auto out = make_shared<vector<int>>(input.size());
+        return function<void()>([&input, table, out] {
+            BinarySearch::indexOfBatch(span<const int>(*table), span<const int>(input), span<int>(*out), true);
+            keep((*out)[0]);
+        });
+    });
+    add("search", "EytzingerIndex indexOf", UNLIMITED, RANDOM_ONLY, searchCase([](shared_ptr<vector<int>> table) {
+        auto index = make_shared<EytzingerIndex<int>>(*table);
+        return [index](int key) { return index->indexOf(key); };
+    }));
+    for (string shape: {"uniform", "lognormal", "clustered"}) {
+        add("search", "BinarySearch indexOf " + shape, UNLIMITED, RANDOM_ONLY,
+            shapedSearchCase(shape, [](shared_ptr<vector<int>> table) {
+                return [table](int key) { return BinarySearch::indexOf(span<int>(*table), key); };
+            }));
+        add("search", "LearnedIndex indexOf " + shape, UNLIMITED, RANDOM_ONLY,
+            shapedSearchCase(shape, [](shared_ptr<vector<int>> table) {
+                auto index = make_shared<LearnedIndex<int>>(*table);
+                return [table, index](int key) { return index->indexOf(key); };
+            }));
+        add("search", "LearnedIndex interpolation indexOf " + shape, UNLIMITED, RANDOM_ONLY,
+            shapedSearchCase(shape, [](shared_ptr<vector<int>> table) {
+                auto index = make_shared<LearnedIndex<int>>(*table, LearnedIndexMode::Interpolation);
+                return [table, index](int key) { return index->indexOf(key); };
+            }));
+    }
+}
+
+/***************************************************************************
+ * Priority queues
+ ***************************************************************************/
+
+// inserts every key into a priority queue, then deletes them all
+template<typename PQ>
+static Prepare minPQCase() {
+    return [](const vector<int> &input) {
+        return function<void()>([&input] {
+            PQ pq;
+            for (int key: input) pq.insert(key);
+            long sum = 0;
+            while (!pq.isEmpty()) sum += pq.delMin();
+            keep(sum);
+        });
+    };
+}
+
+// holds n timers in a priority queue, and n times fires the earliest and schedules it again later;
+// the keys deleted never decrease, as in Dijkstra's algorithm
+template<typename PQ>
+static Prepare timerHoldCase() {
+    return [](const vector<int> &input) {
+        auto pq = make_shared<PQ>();
+        for (int key: input) pq->insert(key);
+        return function<void()>([&input, pq] {
+            long sum = 0;
+            for (int delay: input) {
+                auto time = pq->delMin();
+                sum += time;
+                pq->insert(time + delay % (1 << 20));
+            }
+            keep(sum);
+        });
+    };
+}
+
+// the given number of threads share the input, and each inserts its keys with a deletion after every other one
+static Prepare concurrentMinPQCase(int threads) {
+    return [threads](const vector<int> &input) {
+        return function<void()>([&input, threads] {
+            ConcurrentMinPQ<int> pq(threads);
+            vector<thread> workers;
+            for (int t = 0; t < threads; t++) {
+                workers.emplace_back([&pq, &input, threads, t] {
+                    long sum = 0;
+                    int key;
+                    for (size_t i = t; i < input.size(); i += threads) {
+                        pq.insert(input[i]);
+                        if (i % 2 == 1 && pq.tryDelMin(key)) sum += key;
+                    }
+                    keep(sum);
+                });
+            }
+            for (auto &worker: workers) worker.join();
+        });
+    };
+}
+
+// the same work on a MinPQ behind one lock
+static Prepare lockedMinPQCase(int threads) {
+    return [threads](const vector<int> &input) {
+        return function<void()>([&input, threads] {
+            MinPQ<int> pq;
+            mutex lock;
+            vector<thread> workers;
+            for (int t = 0; t < threads; t++) {
+                workers.emplace_back([&pq, &lock, &input, threads, t] {
+                    long sum = 0;
+                    for (size_t i = t; i < input.size(); i += threads) {
+                        lock_guard<mutex> guard(lock);
+                        pq.insert(input[i]);
+                        if (i % 2 == 1 && !pq.isEmpty()) sum += pq.delMin();
+                    }
+                    keep(sum);
+                });
+            }
+            for (auto &worker: workers) worker.join();
+        });
+    };
+}
+
+static void addPriorityQueues() {
+    add("pq", "MinPQ insert+delMin", UNLIMITED, ALL_DISTRIBUTIONS, minPQCase<MinPQ<int>>());
+    add("pq", "MinPQ<4> insert+delMin", UNLIMITED, ALL_DISTRIBUTIONS, minPQCase<MinPQ<int, 4>>());
+    add("pq", "MinPQ<8> insert+delMin", UNLIMITED, ALL_DISTRIBUTIONS, minPQCase<MinPQ<int, 8>>());
+    add("pq", "PairingHeap insert+delMin", UNLIMITED, ALL_DISTRIBUTIONS, minPQCase<PairingHeap<int>>());
+    add("pq", "MinPQ timer hold", UNLIMITED, RANDOM_ONLY, timerHoldCase<MinPQ<int>>());
+    add("pq", "MinPQ<4> timer hold", UNLIMITED, RANDOM_ONLY, timerHoldCase<MinPQ<int, 4>>());
+    add("pq", "MinPQ<8> timer hold", UNLIMITED, RANDOM_ONLY, timerHoldCase<MinPQ<int, 8>>());
+    add("pq", "PairingHeap timer hold", UNLIMITED, RANDOM_ONLY, timerHoldCase<PairingHeap<int>>());
+    add("pq", "RadixHeap timer hold", UNLIMITED, RANDOM_ONLY, timerHoldCase<RadixHeap<unsigned>>());
+
+    for (int threads: {1, 2, 4, 8, 16, 32}) {
+        string name = to_string(threads) + " threads";
+        add("concurrent", "ConcurrentMinPQ " + name, UNLIMITED, RANDOM_ONLY, concurrentMinPQCase(threads));
+        add("concurrent", "mutex MinPQ " + name, UNLIMITED, RANDOM_ONLY, lockedMinPQCase(threads));
+    }
+
+    // the keys arrive in heaps of 64 that are melded into one
+    add("pq", "MinPQ merge of small heaps", UNLIMITED, RANDOM_ONLY, [](const vector<int> &input) {
+        return function<void()>([&input] {
+            MinPQ<int> pq;
+            for (size_t first = 0; first < input.size(); first += 64) {
+                MinPQ<int> small;
+                for (size_t i = first; i < min(first + 64, input.size()); i++) small.insert(input[i]);
+                pq.merge(std::move(small));
+            }
+            keep(pq.min());
+        });
+    });
+    add("pq", "PairingHeap meld of small heaps", UNLIMITED, RANDOM_ONLY, [](const vector<int> &input) {
+        return function<void()>([&input] {
+            PoolAllocator<int> arena;
+            PairingHeap<int> pq(arena);
+            for (size_t first = 0; first < input.size(); first += 64) {
+                PairingHeap<int> small(arena);
+                for (size_t i = first; i < min(first + 64, input.size()); i++) small.insert(input[i]);
+                pq.meld(std::move(small));
+            }
+            keep(pq.min());
+        });
+    });
+    add("pq", "MaxPQ insert+delMax", UNLIMITED, ALL_DISTRIBUTIONS, [](const vector<int> &input) {
+        return function<void()>([&input] {
+            MaxPQ<int> pq;
+            for (int key: input) pq.insert(key);
+            long sum = 0;
+            while (!pq.isEmpty()) sum += pq.delMax();
+            keep(sum);
+        });
+    });
+    add("pq", "MinPQ heapify", UNLIMITED, ALL_DISTRIBUTIONS, [](const vector<int> &input) {
+        return function<void()>([&input] {
+            MinPQ<int> pq(input);
+            keep(pq.size());
+        });
+    });
+
+
+    // a heap of the first half of the keys takes the second half, and then gives up its n / 10 smallest keys,
+    // one key at a time or in one batch
+    add("pq", "MinPQ insert loop", UNLIMITED, ALL_DISTRIBUTIONS, [](const vector<int> &input) {
+        return function<void()>([&input] {
+            int half = (int) input.size() / 2;
+            MinPQ<int> pq(vector<int>(input.begin(), input.begin() + half));
+            for (int i = half; i < (int) input.size(); i++) pq.insert(input[i]);
+            keep(pq.min());
+        });
+    });
+    add("pq", "MinPQ insertBatch", UNLIMITED, ALL_DISTRIBUTIONS, [](const vector<int> &input) {
+        return function<void()>([&input] {
+            int half = (int) input.size() / 2;
+            MinPQ<int> pq(vector<int>(input.begin(), input.begin() + half));
+            pq.insertBatch(span<const int>(input.data() + half, input.size() - half));
+            keep(pq.min());
+        });
+    });
+    add("pq", "MinPQ merge", UNLIMITED, ALL_DISTRIBUTIONS, [](const vector<int> &input) {
+        return function<void()>([&input] {
+            int half = (int) input.size() / 2;
+            MinPQ<int> pq(vector<int>(input.begin(), input.begin() + half));
+            pq.merge(MinPQ<int>(vector<int>(input.begin() + half, input.end())));
+            keep(pq.min());
+        });
+    });
+    add("pq", "MinPQ delMin loop n/10", UNLIMITED, RANDOM_ONLY, [](const vector<int> &input) {
+        return function<void()>([&input] {
+            MinPQ<int> pq(input);
+            vector<int> out;
+            for (int i = 0; i < (int) input.size() / 10; i++) out.push_back(pq.delMin());
+            keep(out.size());
+        });
+    });
+    add("pq", "MinPQ popK n/10", UNLIMITED, RANDOM_ONLY, [](const vector<int> &input) {
+        return function<void()>([&input] {
+            MinPQ<int> pq(input);
+            vector<int> out;
+            pq.popK((int) input.size() / 10, out);
+            keep(out.size());
+        });
+    });
+    // the 100 largest keys of the stream, from a heap of every key or from a bounded top-k
+    add("pq", "top 100 MaxPQ of all keys", UNLIMITED, ALL_DISTRIBUTIONS, [](const vector<int> &input) {
+        return function<void()>([&input] {
+            MaxPQ<int> pq(input);
+            vector<int> out;
+            pq.popK(100, out);
+            keep(out.size());
+        });
+    });
+    add("pq", "top 100 TopK offer", UNLIMITED, ALL_DISTRIBUTIONS, [](const vector<int> &input) {
+        return function<void()>([&input] {
+            TopK<int> top(100);
+            for (int key: input) top.offer(key);
+            keep(top.min());
+        });
+    });
+    add("pq", "top 100 TopK offerBatch", UNLIMITED, ALL_DISTRIBUTIONS, [](const vector<int> &input) {
+        return function<void()>([&input] {
+            TopK<int> top(100);
+            top.offerBatch(input);
+            keep(top.min());
+        });
+    });
+
+    // the p50, p90, p99 and p99.9 of the stream, exactly from a sorted copy or approximately from a sketch
+    add("pq", "4 quantiles of a sorted copy", UNLIMITED, RANDOM_ONLY, [](const vector<int> &input) {
+        return function<void()>([&input] {
+            vector<int> sorted = input;
+            sort(sorted.begin(), sorted.end());
+            keep(sorted[(size_t) (sorted.size() * 0.999)]);
+        });
+    });
+    add("pq", "4 quantiles QuantileSketch", UNLIMITED, RANDOM_ONLY, [](const vector<int> &input) {
+        return function<void()>([&input] {
+            QuantileSketch<int> sketch;
+            sketch.insertBatch(input);
+            vector<double> qs = {0.5, 0.9, 0.99, 0.999};
+            keep(sketch.quantiles(qs).back());
+        });
+    });
+
+    // n jobs get new priorities n times in total and are then run in order, either by changing their keys
+    // or by inserting a duplicate and skipping stale entries when they come up
+    add("pq", "IndexMinPQ reprioritize", UNLIMITED, RANDOM_ONLY, [](const vector<int> &input) {
+        return function<void()>([&input] {
+            int n = (int) input.size();
+            IndexMinPQ<int> pq(n);
+            for (int i = 0; i < n; i++) pq.insert(i, input[i]);
+            for (int i = 0; i < n; i++) pq.changeKey(input[i] % n, input[n - 1 - i]);
+            long sum = 0;
+            while (!pq.isEmpty()) sum += pq.delMin();
+            keep(sum);
+        });
+    });
+    add("pq", "MinPQ reprioritize with stale entries", UNLIMITED, RANDOM_ONLY, [](const vector<int> &input) {
+        return function<void()>([&input] {
+            int n = (int) input.size();
+            vector<int> priority(input);
+            MinPQ<pair<int, int>> pq;
+            for (int i = 0; i < n; i++) pq.insert({input[i], i});
+            for (int i = 0; i < n; i++) {
+                int job = input[i] % n;
+                priority[job] = input[n - 1 - i];
+                pq.insert({priority[job], job});
+            }
+            long sum = 0;
+            vector<bool> done(n);
+            while (!pq.isEmpty()) {
+                auto [key, job] = pq.delMin();
+                if (done[job] || key != priority[job]) continue;
+                done[job] = true;
+                sum += job;
+            }
+            keep(sum);
+        });
+    });
+}
+
+/***************************************************************************
+ * Union-find
+ ***************************************************************************/
+
+// pairs the input into input.size() unions of sites 0 through input.size()-1
+static shared_ptr<vector<pair<int, int>>> unionPairs(const vector<int> &input) {
+    int n = (int) input.size();
+    auto pairs = make_shared<vector<pair<int, int>>>(n);
+    for (int i = 0; i < n; i++)
+        (*pairs)[i] = {input[i] % n, input[n - 1 - i] % n};
+    return pairs;
+}
+
+// the number of sites and the pairs of large_UF.txt, read once; no pairs if the file is missing
+static const pair<int, vector<pair<int, int>>> &largeUF() {
+    static pair<int, vector<pair<int, int>>> file = [] {
+        pair<int, vector<pair<int, int>>> file{0, {}};
+        if (!ifstream("./Test Files/large_UF.txt").good()) return file;
+        In in("./Test Files/large_UF.txt");
+        file.first = in.readInt();
+        file.second = in.readAllIntPairs();
+        return file;
+    }();
+    return file;
+}
+
+static void addUnionFind() {
+    add("uf", "WeightedQuickUnionUF", UNLIMITED, RANDOM_ONLY, [](const vector<int> &input) {
+        auto pairs = unionPairs(input);
+        return function<void()>([pairs] {
+            WeightedQuickUnionUF uf((int) pairs->size());
+            for (const auto &[p, q]: *pairs) uf.weightedUnion(p, q);
+            keep(uf.count());
+        });
+    });
+    add("uf", "ConcurrentUF unionBatch", UNLIMITED, RANDOM_ONLY, [](const vector<int> &input) {
+        auto pairs = unionPairs(input);
+        return function<void()>([pairs] {
+            ConcurrentUF uf((int) pairs->size());
+            uf.unionBatch(*pairs, pool());
+            keep(uf.count());
+        });
+    });
+
+    // the first n pairs of large_UF.txt, sequentially and then on pools of 1 to 16 threads; every concurrent
+    // run checks its number of components against the sequential one
+    const auto &[sites, pairs] = largeUF();
+    if (pairs.empty()) return;
+    add("uf", "WeightedQuickUnionUF large_UF.txt", (long) pairs.size(), RANDOM_ONLY, [](const vector<int> &input) {
+        return function<void()>([n = input.size()] {
+            const auto &[sites, pairs] = largeUF();
+            WeightedQuickUnionUF uf(sites);
+            for (size_t i = 0; i < n; i++) uf.weightedUnion(pairs[i].first, pairs[i].second);
+            keep(uf.count());
+        });
+    });
+    for (unsigned int threads: {1, 2, 4, 8, 16}) {
+        string name = "ConcurrentUF large_UF.txt " + to_string(threads) + " threads";
+        add("uf", name, (long) pairs.size(), RANDOM_ONLY, [threads](const vector<int> &input) {
+            const auto &[sites, pairs] = largeUF();
+            span<const pair<int, int>> prefix(pairs.data(), input.size());
+            WeightedQuickUnionUF sequential(sites);
+            for (const auto &[p, q]: prefix) sequential.weightedUnion(p, q);
+            auto pool = make_shared<ThreadPool>(threads);
+            return function<void()>([prefix, pool, threads, sites, expected = sequential.count()] {
+                ConcurrentUF uf(sites);
+                uf.unionBatch(prefix, *pool);
+                if (uf.count() != expected)
+                    cerr << "MISMATCH: ConcurrentUF with " << threads << " threads has " << uf.count()
+                         << " components, WeightedQuickUnionUF has " << expected << endl;
+                keep(uf.count());
+            });
+        });
+    }
+}
+
+/***************************************************************************
+ * Containers
+ ***************************************************************************/
+
+// the tokens of the to_be.txt workload: a word is pushed, "-" pops
+static const vector<string> &toBe() {
+    static vector<string> tokens = [] {
+        vector<string> words;
+        In in("./Test Files/to_be.txt");
+        for (auto token: in.readAllStrings()) words.emplace_back(token);
+        return words;
+    }();
+    return tokens;
+}
+
+// replays the to_be.txt workload on a stack, one operation per element
+template<typename Allocator>
+static Prepare stackCase() {
+    return [](const vector<int> &input) {
+        long ops = (long) input.size();
+        return function<void()>([ops] {
+            const vector<string> &tokens = toBe();
+            Stack<string, Allocator> stack{Allocator()};
+            for (long i = 0; i < ops; i++) {
+                const string &token = tokens[i % tokens.size()];
+                if (token != "-") stack.push(token);
+                else if (!stack.isEmpty()) stack.pop();
+            }
+        });
+    };
+}
+
+// replays the to_be.txt workload on a queue, one operation per element
+template<typename Allocator>
+static Prepare queueCase() {
+    return [](const vector<int> &input) {
+        long ops = (long) input.size();
+        return function<void()>([ops] {
+            const vector<string> &tokens = toBe();
+            Queue<string, Allocator> queue{Allocator()};
+            for (long i = 0; i < ops; i++) {
+                const string &token = tokens[i % tokens.size()];
+                if (token != "-") queue.enqueue(token);
+                else if (!queue.isEmpty()) queue.dequeue();
+            }
+        });
+    };
+}
+
+// adds the words of the to_be.txt workload to a bag, one operation per element
+template<typename Allocator>
+static Prepare bagCase() {
+    return [](const vector<int> &input) {
+        long ops = (long) input.size();
+        return function<void()>([ops] {
+            const vector<string> &tokens = toBe();
+            Bag<string, Allocator> bag{Allocator()};
+            for (long i = 0; i < ops; i++) {
+                const string &token = tokens[i % tokens.size()];
+                if (token != "-") bag.add(token);
+            }
+        });
+    };
+}
+
+// moves the input through a queue in batches of 4096, one item at a time
+template<typename QueueType>
+static Prepare batchCase() {
+    return [](const vector<int> &input) {
+        return function<void()>([&input] {
+            QueueType queue;
+            long sum = 0;
+            for (size_t start = 0; start < input.size(); start += 4096) {
+                size_t end = min(start + 4096, input.size());
+                for (size_t i = start; i < end; i++) queue.enqueue(input[i]);
+                for (size_t i = start; i < end; i++) sum += queue.dequeue();
+            }
+            keep(sum);
+        });
+    };
+}
+
+// moves the input from the given number of producers to as many consumers through a ConcurrentQueue
+static Prepare handOffCase(int pairs) {
+    return [pairs](const vector<int> &input) {
+        return function<void()>([&input, pairs] {
+            ConcurrentQueue<int> queue(1 << 14);
+            long perProducer = (long) input.size() / pairs;
+            vector<thread> threads;
+            for (int p = 0; p < pairs; p++) {
+                threads.emplace_back([&queue, &input, perProducer, p] {
+                    for (long i = 0; i < perProducer; i++) queue.enqueue(input[p * perProducer + i]);
+                });
+                threads.emplace_back([&queue, perProducer] {
+                    long sum = 0;
+                    for (long i = 0; i < perProducer; i++) sum += queue.dequeue();
+                    keep(sum);
+                });
+            }
+            for (auto &t: threads) t.join();
+        });
+    };
+}
+
+// moves the input from the given number of producers to as many consumers through a locked Queue
+static Prepare lockedHandOffCase(int pairs) {
+    return [pairs](const vector<int> &input) {
+        return function<void()>([&input, pairs] {
+            Queue<int> queue;
+            mutex lock;
+            long perProducer = (long) input.size() / pairs;
+            vector<thread> threads;
+            for (int p = 0; p < pairs; p++) {
+                threads.emplace_back([&queue, &lock, &input, perProducer, p] {
+                    for (long i = 0; i < perProducer; i++) {
+                        lock_guard<mutex> guard(lock);
+                        queue.enqueue(input[p * perProducer + i]);
+                    }
+                });
+                threads.emplace_back([&queue, &lock, perProducer] {
+                    long sum = 0;
+                    for (long i = 0; i < perProducer;) {
+                        lock_guard<mutex> guard(lock);
+                        if (queue.isEmpty()) continue;
+                        sum += queue.dequeue();
+                        i++;
+                    }
+                    keep(sum);
+                });
+            }
+            for (auto &t: threads) t.join();
+        });
+    };
+}
+
+static void addContainers() {
+    add("container", "Stack to_be", UNLIMITED, RANDOM_ONLY, stackCase<allocator<string>>());
+    add("container", "Stack to_be PoolAllocator", UNLIMITED, RANDOM_ONLY, stackCase<PoolAllocator<string>>());
+    add("container", "Queue to_be", UNLIMITED, RANDOM_ONLY, queueCase<allocator<string>>());
+    add("container", "Queue to_be PoolAllocator", UNLIMITED, RANDOM_ONLY, queueCase<PoolAllocator<string>>());
+    add("container", "Bag to_be", UNLIMITED, RANDOM_ONLY, bagCase<allocator<string>>());
+    add("container", "Bag to_be PoolAllocator", UNLIMITED, RANDOM_ONLY, bagCase<PoolAllocator<string>>());
+    add("container", "Queue batches", UNLIMITED, RANDOM_ONLY, batchCase<Queue<int>>());
+    add("container", "Queue batches PoolAllocator", UNLIMITED, RANDOM_ONLY,
+        batchCase<Queue<int, PoolAllocator<int>>>());
+    add("container", "ResizingArrayQueue batches", UNLIMITED, RANDOM_ONLY, batchCase<ResizingArrayQueue<int>>());
+    add("container", "ResizingArrayQueue bulk", UNLIMITED, RANDOM_ONLY, [](const vector<int> &input) {
+        return function<void()>([&input] {
+            ResizingArrayQueue<int> queue;
+            vector<int> out(4096);
+            long sum = 0;
+            for (size_t start = 0; start < input.size(); start += 4096) {
+                size_t count = min((size_t) 4096, input.size() - start);
+                queue.enqueueBulk(span<const int>(input).subspan(start, count));
+                queue.dequeueBulk(span<int>(out).first(count));
+                sum += out[0];
+            }
+            keep(sum);
+        });
+    });
+    for (int pairs: {1, 2, 4, 8, 16}) {
+        string threads = to_string(pairs) + "x" + to_string(pairs);
+        add("concurrent", "ConcurrentQueue " + threads, UNLIMITED, RANDOM_ONLY, handOffCase(pairs));
+        add("concurrent", "mutex Queue " + threads, UNLIMITED, RANDOM_ONLY, lockedHandOffCase(pairs));
+    }
+}
+
+/***************************************************************************
+ * Input
+ ***************************************************************************/
+
+// the union pairs of the input as a union-find file
+static shared_ptr<InputFile> unionFindFile(const vector<int> &input) {
+    return inputFile("uf", ".txt", input, [&input](const string &path) {
+        auto pairs = unionPairs(input);
+        ofstream file(path);
+        file << input.size() << '\n';
+        for (const auto &[p, q]: *pairs) file << p << ' ' << q << '\n';
+    });
+}
+
+static void addInput() {
+    add("input", "ifstream union-find file", UNLIMITED, RANDOM_ONLY, [](const vector<int> &input) {
+        auto uf = unionFindFile(input);
+        return function<void()>([uf] {
+            ifstream file(uf->path);
+            int n, p, q;
+            file >> n;
+            long sum = 0;
+            while (file >> p >> q) sum += p ^ q;
+            keep(sum);
+        });
+    });
+    add("input", "In union-find file", UNLIMITED, RANDOM_ONLY, [](const vector<int> &input) {
+        auto uf = unionFindFile(input);
+        return function<void()>([uf] {
+            In in(uf->path);
+            int n = in.readInt();
+            keep(n + in.readAllIntPairs().size());
+        });
+    });
+}
+
+/***************************************************************************
+ * External sort
+ ***************************************************************************/
+
+// the input as a file of binary int records, and the name of the sorted file, which is removed with it
+static shared_ptr<InputFile> recordFile(const vector<int> &input) {
+    auto records = inputFile("records", ".bin", input, [&input](const string &path) {
+        ofstream file(path, ios::binary);
+        file.write(reinterpret_cast<const char *>(input.data()), (streamsize) (input.size() * sizeof(int)));
+    });
+    if (records->outputs.empty()) records->outputs.push_back(records->path + ".sorted");
+    return records;
+}
+
+static void addExternalSort() {
+    for (int times: {8, 64}) {
+        string name = "ExternalSort file " + to_string(times) + "x budget";
+        add("external", name, UNLIMITED, RANDOM_ONLY, [times](const vector<int> &input) {
+            auto records = recordFile(input);
+            size_t memory = max<size_t>(sizeof(int), input.size() * sizeof(int) / times);
+            return function<void()>([records, memory] {
+                ExternalSort<int>(records->path, records->outputs[0], memory);
+            });
+        });
+    }
+}
+
+/***************************************************************************
+ * Harness
+ ***************************************************************************/
+
+// the value at the given fraction of the sorted samples, by nearest rank
+static double percentile(const vector<double> &sorted, double fraction) {
+    auto rank = (size_t) ceil(fraction * (double) sorted.size());
+    return sorted[rank == 0 ? 0 : rank - 1];
+}
+
+static Result measure(const Case &c, Distribution distribution, const vector<int> &input, const Options &options) {
+    vector<double> samples;
+    for (int rep = 0; rep < options.warmup + options.reps; rep++) {
+        function<void()> work = c.prepare(input);
+        auto t0 = steady_clock::now();
+        work();
+        auto t1 = steady_clock::now();
+        if (rep >= options.warmup)
+            samples.push_back((double) duration_cast<nanoseconds>(t1 - t0).count() / (double) input.size());
+    }
+    sort(samples.begin(), samples.end());
+    return {c.group, c.name, nameOf(distribution), (long) input.size(), options.reps,
+            percentile(samples, 0.5), percentile(samples, 0.99), samples.front()};
+}
+
+static void printTable(ostream &os, const Result &r) {
+    char line[256];
+    snprintf(line, sizeof line, "%-10s %-40s %-11s %10ld %12.3f %12.3f %12.3f", r.group.c_str(), r.name.c_str(),
+             r.distribution.c_str(), r.n, r.median, r.p99, r.min);
+    os << line << endl;
+}
+
+static void printCsv(ostream &os, const Result &r) {
+    os << r.group << ",\"" << r.name << "\"," << r.distribution << "," << r.n << "," << r.reps << ","
+       << r.median << "," << r.p99 << "," << r.min << endl;
+}
+
+static void printJson(ostream &os, const Result &r, bool first) {
+    os << (first ? "" : ",\n") << "    {\"group\": \"" << r.group << "\", \"name\": \"" << r.name
+       << "\", \"distribution\": \"" << r.distribution << "\", \"n\": " << r.n << ", \"reps\": " << r.reps
+       << ", \"median_ns_per_element\": " << r.median << ", \"p99_ns_per_element\": " << r.p99
+       << ", \"min_ns_per_element\": " << r.min << "}";
+}
+
+static Options parse(int argc, char *argv[]) {
+    Options options;
+    for (int i = 1; i < argc; i += 2) {
+        string arg = argv[i];
+        if (i + 1 >= argc) throw invalid_argument(arg + " is missing its value");
+        string value = argv[i + 1];
+        if (arg == "--sizes") {
+            options.sizes.clear();
+            stringstream ss(value);
+            string size;
+            // sizes may be written as 1e6
+            while (getline(ss, size, ',')) options.sizes.push_back((long) stod(size));
+        } else if (arg == "--reps") {
+            options.reps = max(1, stoi(value));
+        } else if (arg == "--warmup") {
+            options.warmup = max(0, stoi(value));
+        } else if (arg == "--filter") {
+            options.filter = value;
+        } else if (arg == "--format") {
+            if (value != "table" && value != "csv" && value != "json")
+                throw invalid_argument("unknown format " + value);
+            options.format = value;
+        } else if (arg == "--out") {
+            options.out = value;
+        } else {
+            throw invalid_argument("unknown option " + arg);
+        }
+    }
+    for (long n: options.sizes)
+        if (n < 1 || n > UNLIMITED) throw invalid_argument("sizes must be between 1 and 1e8");
+    return options;
+}
+
+int main(int argc, char *argv[]) {
+    Options options;
+    try {
+        options = parse(argc, argv);
+    }
+    catch (exception &e) {
+        cerr << e.what() << endl;
+        cerr << "usage: Benchmark [--sizes 1e3,1e4,...] [--reps 7] [--warmup 2] [--filter text]"
+                " [--format table|csv|json] [--out file]" << endl;
+        return 1;
+    }
+
+    addSorts();
+    addSelection();
+    addSearch();
+    addPriorityQueues();
+    addUnionFind();
+    addContainers();
+    addInput();
+    addExternalSort();
+
+    ofstream file;
+    if (!options.out.empty()) file.open(options.out);
+    ostream &os = options.out.empty() ? cout : file;
+
+    if (options.format == "csv")
+        os << "group,name,distribution,n,reps,median_ns_per_element,p99_ns_per_element,min_ns_per_element" << endl;
+    else if (options.format == "json")
+        os << "{\n  \"benchmarks\": [\n";
+    else
+        os << "group      case                                     distribution         n    median ns       p99 ns"
+              "       min ns" << endl;
+
+    bool first = true;
+    for (long n: options.sizes) {
+        for (Distribution distribution: ALL_DISTRIBUTIONS) {
+            vector<int> input;
+            for (const Case &c: cases) {
+                if (n > c.maxSize) continue;
+                if (find(c.distributions.begin(), c.distributions.end(), distribution) == c.distributions.end())
+                    continue;
+                if ((c.group + " " + c.name).find(options.filter) == string::npos) continue;
+                if (input.empty()) input = generate(distribution, n);
+
+                Result result = measure(c, distribution, input, options);
+                if (options.format == "csv") printCsv(os, result);
+                else if (options.format == "json") printJson(os, result, first);
+                else printTable(os, result);
+                first = false;
+            }
+        }
+    }
+    if (options.format == "json") os << "\n  ]\n}" << endl;
+}
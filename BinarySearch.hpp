@@ -4,9 +4,16 @@
 #include <span>                 // std::span
 #include <array>                // std::array
 #include <vector>               // std::vector
+#include <algorithm>            // std::min, std::is_sorted
+#include <functional>           // std::less, std::greater
+#include <type_traits>          // std::is_same_v
+#include <stdexcept>            // std::invalid_argument
 #include "Comparable.hpp"       // includes Comparable concept used as a constraint
 #include <cassert>              // std::assert
 #include <iostream>             // std::sizeof
+#if defined(__x86_64__)
+#include <immintrin.h>          // AVX2 and AVX-512 gathers and compares
+#endif
 
 /**
  *  The {@code BinarySearch} class provides a static method for binary
@@ -14,6 +21,16 @@
  *
  *  The rankOf operation takes logarithmic time in the worst case.
  *
+ *  The indexOfBatch operation searches for many keys at once. Every search
+ *  waits on a chain of dependent loads, one per level, and once the array is
+ *  larger than the cache nearly every load is a miss. The batch advances 16
+ *  searches in lockstep, one level at a time, and prefetches the next probe
+ *  of each, so the misses of different searches overlap instead of queueing.
+ *  For int keys in ascending order, the searches of a level are done in SIMD
+ *  registers with gathers, 16 at a time with AVX-512 or 8 with AVX2, when the
+ *  processor has them. The probes are the same as those of indexOf, so the
+ *  results are identical, including which of several equal keys is found.
+ *
  *  @author Benjamin Chan
  *
  *  Adapted from Algorithms, 4th edition, {@authors Robert Sedgewick and Kevin Wayne}
@@ -73,7 +90,34 @@ public:
     requires Comparable<T>
     static int indexOf(T a[], int arrayLength, int key, bool reverse = false);
 
+/**
+ * Finds the index of every key of {@code keys} in the sorted array, as {@code indexOf} does.
+ *
+ * @param  sorted the array, must be sorted in ascending order, or descending if {@code reverse}
+ * @param  keys the search keys
+ * @param  out receives in {@code out[i]} the index of {@code keys[i]} in {@code sorted} if present,
+ *         {@code -1} otherwise
+ * @throws invalid_argument if {@code out} is shorter than {@code keys}
+ */
+    template<typename T>
+    requires Comparable<T>
+    static void indexOfBatch(span<const T> sorted, span<const T> keys, span<int> out, bool reverse = false);
+
 private:
+    // the number of searches that advance in lockstep
+    static constexpr int BATCH_LANES = 16;
+
+    template<typename T, typename Less>
+    static void interleavedIndexOf(span<const T> a, span<const T> keys, span<int> out, Less less);
+
+#if defined(__x86_64__)
+    __attribute__((target("avx2")))
+    static size_t indexOfBatchAVX2(span<const int> a, span<const int> keys, span<int> out);
+
+    __attribute__((target("avx512f")))
+    static size_t indexOfBatchAVX512(span<const int> a, span<const int> keys, span<int> out);
+#endif
+
     template<typename T>
     requires Comparable<T>
     static bool isSorted(span<T> a, bool reverse = false);
@@ -211,6 +255,118 @@ int BinarySearch::indexOf(T a[], int length, int key, bool reverse) {
     return -1;
 };
 
+template<typename T>
+requires Comparable<T>
+void BinarySearch::indexOfBatch(span<const T> sorted, span<const T> keys, span<int> out, bool reverse) {
+    if (out.size() < keys.size()) throw invalid_argument("out is shorter than keys");
+    if (!reverse) {
+        assert(is_sorted(sorted.begin(), sorted.end(), std::less<T>()));
+        size_t done = 0;
+#if defined(__x86_64__)
+        if constexpr (is_same_v<T, int>) {
+            if (__builtin_cpu_supports("avx512f")) done = indexOfBatchAVX512(sorted, keys, out);
+            else if (__builtin_cpu_supports("avx2")) done = indexOfBatchAVX2(sorted, keys, out);
+        }
+#endif
+        interleavedIndexOf(sorted, keys.subspan(done), out.subspan(done), std::less<T>());
+    } else {
+        assert(is_sorted(sorted.begin(), sorted.end(), std::greater<T>()));
+        interleavedIndexOf(sorted, keys, out, std::greater<T>());
+    }
+}
+
+template<typename T, typename Less>
+void BinarySearch::interleavedIndexOf(span<const T> a, span<const T> keys, span<int> out, Less less) {
+    int lo[BATCH_LANES], hi[BATCH_LANES], result[BATCH_LANES];
+    for (size_t first = 0; first < keys.size(); first += BATCH_LANES) {
+        int lanes = (int) min<size_t>(BATCH_LANES, keys.size() - first);
+        for (int i = 0; i < lanes; i++) {
+            lo[i] = 0;
+            hi[i] = (int) a.size() - 1;
+            result[i] = -1;
+        }
+
+        // one level of every search that has not ended; the probe of the next level is
+        // prefetched, and is loaded only after the other searches have taken their step
+        for (bool active = true; active;) {
+            active = false;
+            for (int i = 0; i < lanes; i++) {
+                if (lo[i] > hi[i]) continue;
+                int mid = lo[i] + (hi[i] - lo[i]) / 2;
+                const T &key = keys[first + i];
+                bool below = less(key, a[mid]);
+                bool above = less(a[mid], key);
+                hi[i] = below ? mid - 1 : hi[i];
+                lo[i] = above ? mid + 1 : lo[i];
+                if (!below && !above) {
+                    result[i] = mid;
+                    lo[i] = hi[i] + 1;
+                } else if (lo[i] <= hi[i]) {
+                    __builtin_prefetch(a.data() + lo[i] + (hi[i] - lo[i]) / 2);
+                    active = true;
+                }
+            }
+        }
+        for (int i = 0; i < lanes; i++) out[first + i] = result[i];
+    }
+}
+
+#if defined(__x86_64__)
+// searches for the keys 8 at a time, and returns how many keys were searched for
+__attribute__((target("avx2")))
+inline size_t BinarySearch::indexOfBatchAVX2(span<const int> a, span<const int> keys, span<int> out) {
+    const __m256i one = _mm256_set1_epi32(1);
+    size_t first = 0;
+    for (; first + 8 <= keys.size(); first += 8) {
+        __m256i key = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(keys.data() + first));
+        __m256i lo = _mm256_setzero_si256();
+        __m256i hi = _mm256_set1_epi32((int) a.size() - 1);
+        __m256i result = _mm256_set1_epi32(-1);
+        __m256i active = _mm256_xor_si256(_mm256_cmpgt_epi32(lo, hi), _mm256_set1_epi32(-1));
+        while (!_mm256_testz_si256(active, active)) {
+            __m256i mid = _mm256_add_epi32(lo, _mm256_srli_epi32(_mm256_sub_epi32(hi, lo), 1));
+            __m256i probe = _mm256_mask_i32gather_epi32(_mm256_setzero_si256(), a.data(), mid, active, 4);
+            __m256i below = _mm256_and_si256(active, _mm256_cmpgt_epi32(probe, key));
+            __m256i above = _mm256_and_si256(active, _mm256_cmpgt_epi32(key, probe));
+            __m256i equal = _mm256_andnot_si256(_mm256_or_si256(below, above), active);
+            result = _mm256_blendv_epi8(result, mid, equal);
+            hi = _mm256_blendv_epi8(hi, _mm256_sub_epi32(mid, one), below);
+            lo = _mm256_blendv_epi8(lo, _mm256_add_epi32(mid, one), above);
+            active = _mm256_andnot_si256(_mm256_or_si256(equal, _mm256_cmpgt_epi32(lo, hi)), active);
+        }
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(out.data() + first), result);
+    }
+    return first;
+}
+
+// searches for the keys 16 at a time, and returns how many keys were searched for
+__attribute__((target("avx512f")))
+inline size_t BinarySearch::indexOfBatchAVX512(span<const int> a, span<const int> keys, span<int> out) {
+    const __m512i one = _mm512_set1_epi32(1);
+    size_t first = 0;
+    for (; first + 16 <= keys.size(); first += 16) {
+        __m512i key = _mm512_loadu_si512(keys.data() + first);
+        __m512i lo = _mm512_setzero_si512();
+        __m512i hi = _mm512_set1_epi32((int) a.size() - 1);
+        __m512i result = _mm512_set1_epi32(-1);
+        __mmask16 active = _mm512_cmple_epi32_mask(lo, hi);
+        while (active) {
+            __m512i mid = _mm512_add_epi32(lo, _mm512_maskz_srli_epi32((__mmask16) -1, _mm512_sub_epi32(hi, lo), 1));
+            __m512i probe = _mm512_mask_i32gather_epi32(_mm512_setzero_si512(), active, mid, a.data(), 4);
+            __mmask16 below = _mm512_mask_cmplt_epi32_mask(active, key, probe);
+            __mmask16 above = _mm512_mask_cmpgt_epi32_mask(active, key, probe);
+            __mmask16 equal = active & ~below & ~above;
+            result = _mm512_mask_mov_epi32(result, equal, mid);
+            hi = _mm512_mask_sub_epi32(hi, below, mid, one);
+            lo = _mm512_mask_add_epi32(lo, above, mid, one);
+            active = _mm512_mask_cmple_epi32_mask(active & ~equal, lo, hi);
+        }
+        _mm512_storeu_si512(out.data() + first, result);
+    }
+    return first;
+}
+#endif
+
 template<typename T>
 requires Comparable<T>
 bool BinarySearch::isSorted(span<T> a, bool reverse) {
@@ -0,0 +1,155 @@
+#ifndef ALGORITHMS_BUFFEREDMERGE_HPP
+#define ALGORITHMS_BUFFEREDMERGE_HPP
+
+#include <span>                 // std::span
+#include <algorithm>            // std::min, std::move, std::move_backward, std::rotate
+#include <utility>              // std::move
+
+using namespace std;
+
+/**
+ *  The memory-bounded merging routines shared by {@code MergeSort} and
+ *  {@code MergeSortBU}, which merge through a scratch buffer of any length
+ *  supplied by the caller instead of an auxiliary array as long as the input.
+ *
+ *  A merge whose shorter run fits in the buffer moves that run into the
+ *  buffer and merges it back. Otherwise the merge is split in two by rotation:
+ *  the middle item of the longer run is located in the shorter run by binary
+ *  search, the two blocks between them swap places, and the two smaller merges
+ *  that result are done the same way. The rotations also go through the buffer
+ *  when the shorter block fits. With no buffer a merge of n items takes
+ *  Θ(n log n) moves, so the sort takes Θ(n log² n) time; every item that the
+ *  buffer can hold removes levels of splitting, and a buffer of n / 2 items
+ *  merges in linear time. The merges are stable.
+ *
+ *  Each routine orders items by {@code less}, which is {@code std::less<T>} for
+ *  an ascending order and {@code std::greater<T>} for a descending one.
+ *
+ *  @author Benjamin Chan
+ */
+
+// subarrays of at most this many items are sorted by binary insertion sort before merging
+static constexpr int BUFFERED_MERGE_CUTOFF = 16;
+
+/**
+ * Sorts {@code a[lo..hi]} stably by binary insertion sort.
+ */
+template<typename T, typename Less>
+void binaryInsertionSort(span<T> a, int lo, int hi, Less less) {
+    for (int i = lo + 1; i <= hi; i++) {
+        T v = std::move(a[i]);
+
+        // find the first item greater than v, so that equal items keep their order
+        int left = lo, right = i;
+        while (left < right) {
+            int mid = left + (right - left) / 2;
+            if (less(v, a[mid])) right = mid;
+            else left = mid + 1;
+        }
+        move_backward(a.begin() + left, a.begin() + i, a.begin() + i + 1);
+        a[left] = std::move(v);
+    }
+}
+
+/**
+ * Exchanges the adjacent blocks {@code a[lo..mid]} and {@code a[mid+1..hi]},
+ * through {@code buffer} if the shorter block fits in it.
+ */
+template<typename T>
+void bufferedRotate(span<T> a, int lo, int mid, int hi, span<T> buffer) {
+    int len1 = mid - lo + 1;
+    int len2 = hi - mid;
+    if (len1 == 0 || len2 == 0) return;
+    if (len2 <= len1 && len2 <= (int) buffer.size()) {
+        std::move(a.begin() + mid + 1, a.begin() + hi + 1, buffer.begin());
+        move_backward(a.begin() + lo, a.begin() + mid + 1, a.begin() + hi + 1);
+        std::move(buffer.begin(), buffer.begin() + len2, a.begin() + lo);
+    } else if (len1 <= (int) buffer.size()) {
+        std::move(a.begin() + lo, a.begin() + mid + 1, buffer.begin());
+        std::move(a.begin() + mid + 1, a.begin() + hi + 1, a.begin() + lo);
+        std::move(buffer.begin(), buffer.begin() + len1, a.begin() + lo + len2);
+    } else {
+        rotate(a.begin() + lo, a.begin() + mid + 1, a.begin() + hi + 1);
+    }
+}
+
+/**
+ * Merges the sorted subarrays {@code a[lo..mid]} and {@code a[mid+1..hi]}
+ * stably, using no memory but {@code buffer}, which may be empty.
+ */
+template<typename T, typename Less>
+void bufferedMerge(span<T> a, int lo, int mid, int hi, span<T> buffer, Less less) {
+    int size = buffer.size();
+    while (lo <= mid && mid < hi) {
+
+        // the runs are already in order
+        if (!less(a[mid + 1], a[mid])) return;
+
+        int len1 = mid - lo + 1;
+        int len2 = hi - mid;
+
+        // move the left run into the buffer and merge forwards
+        if (len1 <= len2 && len1 <= size) {
+            std::move(a.begin() + lo, a.begin() + mid + 1, buffer.begin());
+            int i = 0, j = mid + 1, k = lo;
+            while (i < len1 && j <= hi) {
+                if (less(a[j], buffer[i])) a[k++] = std::move(a[j++]);
+                else a[k++] = std::move(buffer[i++]);
+            }
+            std::move(buffer.begin() + i, buffer.begin() + len1, a.begin() + k);
+            return;
+        }
+
+        // move the right run into the buffer and merge backwards
+        if (len2 <= size) {
+            std::move(a.begin() + mid + 1, a.begin() + hi + 1, buffer.begin());
+            int i = mid, j = len2 - 1, k = hi;
+            while (i >= lo && j >= 0) {
+                if (less(buffer[j], a[i])) a[k--] = std::move(a[i--]);
+                else a[k--] = std::move(buffer[j--]);
+            }
+            move_backward(buffer.begin(), buffer.begin() + j + 1, a.begin() + k + 1);
+            return;
+        }
+
+        // split the longer run in half, and the shorter run where that half's first item belongs
+        int cut1, cut2;
+        if (len1 >= len2) {
+            cut1 = lo + len1 / 2;
+            int first = mid + 1, last = hi + 1;
+            while (first < last) {
+                int m = first + (last - first) / 2;
+                if (less(a[m], a[cut1])) first = m + 1;
+                else last = m;
+            }
+            cut2 = first;
+        } else {
+            cut2 = mid + 1 + len2 / 2;
+            int first = lo, last = mid + 1;
+            while (first < last) {
+                int m = first + (last - first) / 2;
+                if (less(a[cut2], a[m])) last = m;
+                else first = m + 1;
+            }
+            cut1 = first;
+        }
+
+        // a[lo..cut1-1] a[cut1..mid] a[mid+1..cut2-1] a[cut2..hi] becomes
+        // a[lo..cut1-1] a[mid+1..cut2-1] a[cut1..mid] a[cut2..hi]
+        bufferedRotate(a, cut1, mid, cut2 - 1, buffer);
+        int split = cut1 + (cut2 - mid - 1);
+
+        // recurse on the shorter of the two merges and loop on the longer
+        if (split - lo < hi - split) {
+            bufferedMerge(a, lo, cut1 - 1, split - 1, buffer, less);
+            lo = split;
+            mid = split + (mid - cut1);
+        } else {
+            bufferedMerge(a, split, split + (mid - cut1), hi, buffer, less);
+            hi = split - 1;
+            mid = cut1 - 1;
+        }
+    }
+}
+
+#endif //ALGORITHMS_BUFFEREDMERGE_HPP
@@ -0,0 +1,265 @@
+#ifndef ALGORITHMS_CONCURRENTMINPQ_HPP
+#define ALGORITHMS_CONCURRENTMINPQ_HPP
+
+#include <atomic>                   // std::atomic
+#include <memory>                   // std::unique_ptr
+#include <mutex>                    // std::mutex, std::unique_lock, std::try_to_lock, std::try_lock, std::lock
+#include <thread>                   // std::thread::hardware_concurrency, std::this_thread::yield
+#include <optional>                 // std::optional
+#include <algorithm>                // std::max
+#include <exception>                // std::exception
+#include <stdexcept>                // std::invalid_argument
+#include <cstdint>                  // std::uint64_t
+#include "Comparable.hpp"           // includes Comparable concept used as a constraint
+#include "MinPQ.hpp"                // the priority queue of every shard
+
+using namespace std;
+
+/**
+ *  The orderings a {@code ConcurrentMinPQ} can give its deletions:
+ *  {@code Relaxed} spreads the keys over many shards, and {@code Strict}
+ *  keeps them in one, so every deletion removes a smallest key.
+ */
+enum class ConcurrentMinPQMode {
+    Relaxed, Strict
+};
+
+/**
+ *  The {@code ConcurrentMinPQ} class represents a priority queue of generic
+ *  keys that any number of threads may insert into and delete from at the same
+ *  time. It supports the insert, delete-the-minimum, min, size and is-empty
+ *  operations of {@code MinPQ}, and a non-throwing try variant of delete.
+ *
+ *  This implementation is the MultiQueue of Rihani, Sanders and Dementiev. The
+ *  keys are spread over c p shards for p threads, each a {@code MinPQ} with its
+ *  own lock on its own cache line. An insertion locks a random shard. A
+ *  deletion locks two random shards and deletes the smaller of their two
+ *  minimums. A lock that is busy is not waited for at first: the thread picks
+ *  other shards instead, so threads only meet when they happen to choose the
+ *  same shard, and no lock is shared by all of them. A deletion never settles
+ *  for one of its two shards; after several busy pairs in a row it waits for
+ *  both locks of the next pair together.
+ *
+ *  The order is relaxed: a deletion returns a small key, but not always a
+ *  smallest one. For m shards, the rank of a deleted key among the keys on the
+ *  priority queue is O(m) in expectation, and O(m log m) with high probability
+ *  (Alistarh, Kopinsky, Li and Nadiradze, 2017). The strict mode uses a single
+ *  shard, which makes every deletion exact and serializes all operations.
+ *  The insert and delete-the-minimum operations take Θ(log(n)) time when
+ *  uncontended. The min operation locks every shard in turn, and like the
+ *  size and is-empty operations, it is exact only when no other thread is
+ *  modifying the priority queue.
+ *
+ *  @author Benjamin Chan
+ *
+ *  @param <T> the generic type of key on this priority queue
+ */
+template<typename T> requires Comparable<T>
+class ConcurrentMinPQ {
+public:
+    /**
+     * Initializes an empty priority queue for the given number of threads.
+     *
+     * @param  threads the number of threads that will use this priority queue
+     * @param  mode the ordering of the deletions
+     * @param  shardsPerThread the number of shards per thread, c
+     * @throws invalid_argument if {@code threads < 1} or {@code shardsPerThread < 1}
+     */
+    explicit ConcurrentMinPQ(int threads = (int) thread::hardware_concurrency(),
+                             ConcurrentMinPQMode mode = ConcurrentMinPQMode::Relaxed, int shardsPerThread = 2) {
+        if (threads < 1) throw invalid_argument("threads is less than one.");
+        if (shardsPerThread < 1) throw invalid_argument("shardsPerThread is less than one.");
+        m = mode == ConcurrentMinPQMode::Strict ? 1 : max(2, threads * shardsPerThread);
+        shards = make_unique<Shard[]>(m);
+    }
+
+    /// Prevents the invocation of the constructor with an lvalue priority queue
+    ConcurrentMinPQ(const ConcurrentMinPQ<T> &other) = delete;
+
+    /// Prevents the invocation of the constructor with an rvalue priority queue
+    ConcurrentMinPQ(ConcurrentMinPQ<T> &&other) = delete;
+
+    /**
+     * Returns true if this priority queue is empty.
+     *
+     * @return {@code true} if this priority queue is empty;
+     *         {@code false} otherwise
+     */
+    bool isEmpty() const {
+        return size() == 0;
+    }
+
+    /**
+     * Returns the number of keys on this priority queue.
+     *
+     * @return the number of keys on this priority queue
+     */
+    int size() const {
+        return n.load(memory_order_acquire);
+    }
+
+    /**
+     * Returns the number of shards the keys are spread over.
+     *
+     * @return the number of shards
+     */
+    int shardCount() const {
+        return m;
+    }
+
+    /**
+     * Returns a smallest key on this priority queue.
+     *
+     * @return a smallest key on this priority queue
+     * @throws NoSuchElementException if this priority queue is empty
+     */
+    T min();
+
+    /**
+     * Adds a new key to this priority queue.
+     *
+     * @param  x the new key to add to this priority queue
+     */
+    void insert(T x);
+
+    /**
+     * Removes a small key from this priority queue, if there is any; in the
+     * strict mode, a smallest key.
+     *
+     * @param  key receives the key that was removed
+     * @return {@code true} if a key was removed; {@code false} if this priority queue is empty
+     */
+    bool tryDelMin(T &key);
+
+    /**
+     * Removes and returns a small key on this priority queue; in the strict mode, a smallest key.
+     *
+     * @return a small key on this priority queue
+     * @throws NoSuchElementException if this priority queue is empty
+     */
+    T delMin() {
+        T key;
+        if (!tryDelMin(key)) throw NoSuchElementException();
+        return key;
+    }
+
+    /**
+     * @def the NoSuchElementException if there are no items in the priority queue
+     */
+    struct NoSuchElementException : public std::exception {
+        [[nodiscard]] const char *what() const noexcept override {
+            return "Priority Queue Underflow";
+        }
+    };
+
+private:
+    /// a priority queue and its lock, padded to its own cache line to avoid false sharing
+    struct alignas(64) Shard {
+        mutex lock;
+        MinPQ<T> pq;
+    };
+
+    /// the shards
+    unique_ptr<Shard[]> shards;
+
+    /// the number of shards
+    int m;
+
+    /// the number of keys on all shards
+    atomic<int> n{0};
+
+    /// returns a random shard, from a generator of the calling thread
+    int randomShard() const {
+        thread_local uint64_t state = 0x9E3779B97F4A7C15ull ^ (uint64_t) hash<thread::id>()(this_thread::get_id());
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        return (int) (state % (uint64_t) m);
+    }
+};
+
+template<typename T>
+requires Comparable<T>
+T ConcurrentMinPQ<T>::min() {
+    optional<T> min;
+    for (int i = 0; i < m; i++) {
+        lock_guard<mutex> guard(shards[i].lock);
+        if (!shards[i].pq.isEmpty() && (!min || shards[i].pq.min() < *min)) min = shards[i].pq.min();
+    }
+    if (!min) throw NoSuchElementException();
+    return *min;
+}
+
+template<typename T>
+requires Comparable<T>
+void ConcurrentMinPQ<T>::insert(T x) {
+    // take the first random shard that is free, and wait only if several in a row are busy
+    for (int attempt = 0;; attempt++) {
+        Shard &shard = shards[randomShard()];
+        unique_lock<mutex> guard(shard.lock, try_to_lock);
+        if (!guard.owns_lock()) {
+            if (attempt < 4) continue;
+            guard.lock();
+        }
+        shard.pq.insert(std::move(x));
+        n.fetch_add(1, memory_order_release);
+        return;
+    }
+}
+
+template<typename T>
+requires Comparable<T>
+bool ConcurrentMinPQ<T>::tryDelMin(T &key) {
+    if (m == 1) {
+        lock_guard<mutex> guard(shards[0].lock);
+        if (shards[0].pq.isEmpty()) return false;
+        key = shards[0].pq.delMin();
+        n.fetch_sub(1, memory_order_release);
+        return true;
+    }
+
+    for (int attempt = 0, busy = 0;; attempt++) {
+        if (n.load(memory_order_acquire) == 0) return false;
+
+        // lock two different random shards and delete from the one with the smaller minimum; deleting from
+        // either alone when the other is busy would lose the rank bound under contention, so a busy pair is
+        // dropped for a fresh one, and after several in a row both locks are waited for together, which
+        // std::lock does without deadlock
+        int i = randomShard(), j = randomShard();
+        if (i == j) j = (j + 1) % m;
+        unique_lock<mutex> first(shards[i].lock, defer_lock), second(shards[j].lock, defer_lock);
+        if (busy < 4) {
+            if (std::try_lock(first, second) != -1) {
+                busy++;
+                continue;
+            }
+        } else {
+            std::lock(first, second);
+        }
+        busy = 0;
+        Shard *best = shards[i].pq.isEmpty() ? nullptr : &shards[i];
+        if (!shards[j].pq.isEmpty() && (best == nullptr || shards[j].pq.min() < best->pq.min())) best = &shards[j];
+        if (best != nullptr) {
+            key = best->pq.delMin();
+            n.fetch_sub(1, memory_order_release);
+            return true;
+        }
+
+        // a few keys on many shards are hard to hit at random: look at every shard in turn
+        if (attempt >= m) {
+            first.unlock();
+            second.unlock();
+            for (int k = 0; k < m; k++) {
+                lock_guard<mutex> guard(shards[k].lock);
+                if (shards[k].pq.isEmpty()) continue;
+                key = shards[k].pq.delMin();
+                n.fetch_sub(1, memory_order_release);
+                return true;
+            }
+            attempt = 0;
+            this_thread::yield();
+        }
+    }
+}
+
+#endif //ALGORITHMS_CONCURRENTMINPQ_HPP
@@ -0,0 +1,206 @@
+#ifndef ALGORITHMS_CONCURRENTQUEUE_HPP
+#define ALGORITHMS_CONCURRENTQUEUE_HPP
+
+#include <atomic>                   // std::atomic
+#include <cstddef>                  // std::size_t
+#include <memory>                   // std::unique_ptr
+#include <thread>                   // std::this_thread::yield
+#include <stdexcept>                // std::invalid_argument
+
+/**
+ *  The {@code ConcurrentQueue} class represents a bounded first-in-first-out
+ *  (FIFO) queue of generic items that any number of threads may enqueue to and
+ *  dequeue from at the same time.
+ *  It supports the enqueue and dequeue operations of {@code Queue}, which wait
+ *  while the queue is full or empty, non-waiting try variants, and methods for
+ *  testing if the queue is empty and for its size.
+ *
+ *  This implementation is the lock-free bounded queue of Dmitry Vyukov. The
+ *  items live in a circular buffer whose capacity is a power of two, and every
+ *  slot carries a sequence number that tells a producer whether the slot is
+ *  free for its ticket and a consumer whether the slot has been filled for its
+ *  ticket. A thread claims a ticket with a single compare-and-swap on the
+ *  enqueue or dequeue position, each on its own cache line, so producers and
+ *  consumers only contend among themselves and never take a lock.
+ *  The try operations take Θ(1) time when uncontended.
+ *  The size and is-empty operations are exact only when no other thread is
+ *  modifying the queue.
+ *
+ *  @author Benjamin Chan
+ *
+ *  @param <T> the generic type of an item in this queue
+ */
+template<typename T>
+class ConcurrentQueue {
+public:
+    /**
+     * Initializes an empty queue that holds at most {@code capacity} items.
+     *
+     * @param  capacity the maximum number of items, rounded up to a power of two
+     * @throws invalid_argument if {@code capacity < 1}
+     */
+    explicit ConcurrentQueue(size_t capacity = 1024) {
+        if (capacity < 1) throw std::invalid_argument("capacity is less than one.");
+        size_t size = 1;
+        while (size < capacity) size *= 2;
+        mask = size - 1;
+        slots = std::make_unique<Slot[]>(size);
+        for (size_t i = 0; i < size; i++)
+            slots[i].sequence.store(i, std::memory_order_relaxed);
+        enqueuePos.value.store(0, std::memory_order_relaxed);
+        dequeuePos.value.store(0, std::memory_order_relaxed);
+    }
+
+    /// Prevents the invocation of the constructor with an lvalue queue
+    ConcurrentQueue(const ConcurrentQueue<T> &other) = delete;
+
+    /// Prevents the invocation of the constructor with an rvalue queue
+    ConcurrentQueue(ConcurrentQueue<T> &&other) = delete;
+
+    /**
+     * Returns true if this queue is empty.
+     *
+     * @return {@code true} if this queue is empty; {@code false} otherwise
+     */
+    inline bool isEmpty() const {
+        return size() == 0;
+    }
+
+    /**
+     * Returns the number of items in this queue.
+     *
+     * @return the number of items in this queue
+     */
+    inline int size() const {
+        size_t head = dequeuePos.value.load(std::memory_order_acquire);
+        size_t tail = enqueuePos.value.load(std::memory_order_acquire);
+        return tail > head ? (int) (tail - head) : 0;
+    }
+
+    /**
+     * Returns the maximum number of items in this queue.
+     *
+     * @return the maximum number of items in this queue
+     */
+    inline int capacity() const {
+        return (int) (mask + 1);
+    }
+
+    /**
+     * Adds the item to this queue if it is not full.
+     *
+     * @param  item the item to add
+     * @return {@code true} if the item was added; {@code false} if this queue is full
+     */
+    bool tryEnqueue(const T &item);
+
+    /**
+     * Removes the item on this queue that was least recently added, if there is any.
+     *
+     * @param  item receives the item that was removed
+     * @return {@code true} if an item was removed; {@code false} if this queue is empty
+     */
+    bool tryDequeue(T &item);
+
+    /**
+     * Adds the item to this queue, waiting while it is full.
+     *
+     * @param  item the item to add
+     */
+    void enqueue(const T &item) {
+        for (int spins = 0; !tryEnqueue(item); spins++)
+            backoff(spins);
+    }
+
+    /**
+     * Removes and returns the item on this queue that was least recently added,
+     * waiting while it is empty.
+     *
+     * @return the item on this queue that was least recently added
+     */
+    T dequeue() {
+        T item;
+        for (int spins = 0; !tryDequeue(item); spins++)
+            backoff(spins);
+        return item;
+    }
+
+private:
+    /// a slot of the circular buffer
+    struct Slot {
+        std::atomic<size_t> sequence;
+        T item;
+    };
+
+    /// a position padded to its own cache line to avoid false sharing
+    struct alignas(64) Position {
+        std::atomic<size_t> value;
+    };
+
+    /// the circular buffer
+    std::unique_ptr<Slot[]> slots;
+
+    /// the index mask of the circular buffer
+    size_t mask;
+
+    /// the ticket of the next enqueue
+    Position enqueuePos;
+
+    /// the ticket of the next dequeue
+    Position dequeuePos;
+
+    /// spins briefly, then yields the processor while waiting
+    static inline void backoff(int spins) {
+        if (spins > 64) std::this_thread::yield();
+    }
+};
+
+template<typename T>
+bool ConcurrentQueue<T>::tryEnqueue(const T &item) {
+    size_t pos = enqueuePos.value.load(std::memory_order_relaxed);
+    while (true) {
+        Slot &slot = slots[pos & mask];
+        size_t sequence = slot.sequence.load(std::memory_order_acquire);
+        auto diff = (long long) sequence - (long long) pos;
+        if (diff == 0) {
+            // the slot is free for this ticket, so try to claim the ticket
+            if (enqueuePos.value.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                slot.item = item;
+                slot.sequence.store(pos + 1, std::memory_order_release);
+                return true;
+            }
+        } else if (diff < 0) {
+            // the slot still holds the item of the previous lap: the queue is full
+            return false;
+        } else {
+            // another producer claimed this ticket
+            pos = enqueuePos.value.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+template<typename T>
+bool ConcurrentQueue<T>::tryDequeue(T &item) {
+    size_t pos = dequeuePos.value.load(std::memory_order_relaxed);
+    while (true) {
+        Slot &slot = slots[pos & mask];
+        size_t sequence = slot.sequence.load(std::memory_order_acquire);
+        auto diff = (long long) sequence - (long long) (pos + 1);
+        if (diff == 0) {
+            // the slot was filled for this ticket, so try to claim the ticket
+            if (dequeuePos.value.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                item = std::move(slot.item);
+                slot.sequence.store(pos + mask + 1, std::memory_order_release);
+                return true;
+            }
+        } else if (diff < 0) {
+            // the slot has not been filled yet: the queue is empty
+            return false;
+        } else {
+            // another consumer claimed this ticket
+            pos = dequeuePos.value.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+#endif //ALGORITHMS_CONCURRENTQUEUE_HPP
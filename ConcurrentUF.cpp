@@ -0,0 +1,89 @@
+#include "ConcurrentUF.hpp"
+
+ConcurrentUF::ConcurrentUF(int n) : n(n), thisCount(n) {
+    if (n < 0) throw invalid_argument("n is less than zero.");
+    parent = make_unique<atomic<int>[]>(n);
+    for (int i = 0; i < n; i++)
+        parent[i].store(i, memory_order_relaxed);
+}
+
+void ConcurrentUF::validate(int p) const {
+    if (p < 0 || p >= n)
+        throw invalid_argument("index " + to_string(p) + " is not between 0 and " + to_string(n - 1));
+}
+
+int ConcurrentUF::find(int p) {
+    validate(p);
+    return root(p);
+}
+
+int ConcurrentUF::root(int p) {
+    while (true) {
+        int up = parent[p].load(memory_order_acquire);
+        if (up == p) return p;
+        int grand = parent[up].load(memory_order_acquire);
+
+        // path halving: point p at its grandparent, unless another thread already moved it
+        if (up != grand) parent[p].compare_exchange_weak(up, grand, memory_order_release, memory_order_relaxed);
+        p = grand;
+    }
+}
+
+bool ConcurrentUF::connected(int p, int q) {
+    validate(p);
+    validate(q);
+    while (true) {
+        int rootP = root(p);
+        int rootQ = root(q);
+        if (rootP == rootQ) return true;
+
+        // rootP was still a root after rootQ was found, so they were apart at that moment
+        if (parent[rootP].load(memory_order_acquire) == rootP) return false;
+    }
+}
+
+bool ConcurrentUF::concurrentUnion(int p, int q) {
+    validate(p);
+    validate(q);
+    return link(p, q);
+}
+
+bool ConcurrentUF::link(int p, int q) {
+    while (true) {
+        int rootP = root(p);
+        int rootQ = root(q);
+        if (rootP == rootQ) return false;
+
+        // make the root of larger index point to the root of smaller index
+        if (rootP < rootQ) swap(rootP, rootQ);
+        int expected = rootP;
+        if (parent[rootP].compare_exchange_strong(expected, rootQ, memory_order_acq_rel)) {
+            thisCount.fetch_sub(1, memory_order_acq_rel);
+            return true;
+        }
+
+        // another thread linked rootP first, so retry from the new roots
+        p = rootP;
+        q = rootQ;
+    }
+}
+
+void ConcurrentUF::unionBatch(span<const pair<int, int>> pairs, ThreadPool &pool) {
+    for (const auto &[p, q]: pairs) {
+        validate(p);
+        validate(q);
+    }
+
+    // a few chunks per thread, so that threads finishing early can steal the rest
+    size_t chunks = pool.size() * 4;
+    size_t step = (pairs.size() + chunks - 1) / chunks;
+    if (step == 0) return;
+    TaskGroup group(pool);
+    for (size_t start = 0; start < pairs.size(); start += step) {
+        span<const pair<int, int>> chunk = pairs.subspan(start, min(step, pairs.size() - start));
+        group.run([this, chunk] {
+            for (const auto &[p, q]: chunk) link(p, q);
+        });
+    }
+    group.wait();
+}
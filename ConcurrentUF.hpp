@@ -0,0 +1,120 @@
+#ifndef ALGORITHMS_CONCURRENTUF_HPP
+#define ALGORITHMS_CONCURRENTUF_HPP
+
+#include <atomic>                   // std::atomic
+#include <memory>                   // std::unique_ptr, std::make_unique
+#include <span>                     // std::span
+#include <string>                   // std::string, std::to_string
+#include <utility>                  // std::pair
+#include <stdexcept>                // std::invalid_argument
+#include "ThreadPool.hpp"           // the pool that runs a batch union in parallel
+
+using namespace std;
+
+/**
+ *  The {@code ConcurrentUF} class represents a union–find data type
+ *  (also known as the disjoint-sets data type) that any number of threads may
+ *  query and merge at the same time.
+ *  It supports the union, find and count operations of
+ *  {@code WeightedQuickUnionUF}, along with a connected operation and a batch
+ *  union operation that spreads a list of pairs across a thread pool.
+ *
+ *  This implementation is the lock-free union-find of Jayanti and Tarjan.
+ *  Every parent link is an atomic integer. A union links one root under the
+ *  other with a single compare-and-swap, which fails (and is retried from the
+ *  new roots) if another thread linked that root first. The find operation
+ *  compresses paths by halving, replacing parent links with grandparent links
+ *  by compare-and-swap, so a thread never undoes another thread's work.
+ *
+ *  Roots are linked by index: the root with the larger index always points to
+ *  the root with the smaller one. This forbids cycles without locking and
+ *  makes the result deterministic: once all unions have completed, the
+ *  canonical element of every set is its smallest element, whatever the
+ *  interleaving of the threads.
+ *  The constructor takes Θ(n) time. The count operation takes Θ(1) time.
+ *
+ *  @author Benjamin Chan
+ */
+class ConcurrentUF {
+    // parent[i] = parent of i
+    unique_ptr<atomic<int>[]> parent;
+    // number of elements
+    int n;
+    // number of components
+    atomic<int> thisCount;
+public:
+    /**
+     * Initializes an empty union-find data structure with
+     * {@code n} elements {@code 0} through {@code n-1}.
+     * Initially, each elements is in its own set.
+     *
+     * @param  n the number of elements
+     * @throws invalid_argument if {@code n < 0}
+     */
+    explicit ConcurrentUF(int n);
+
+    /**
+     * Returns the canonical element of the set containing element {@code p}.
+     *
+     * @param  p an element
+     * @return the canonical element of the set containing {@code p}
+     * @throws invalid_argument unless {@code 0 <= p < n}
+     */
+    int find(int p);
+
+    /**
+     * Returns true if the two elements are in the same set.
+     *
+     * @param  p one element
+     * @param  q the other element
+     * @return {@code true} if {@code p} and {@code q} are in the same set;
+     *         {@code false} otherwise
+     * @throws invalid_argument unless
+     *         both {@code 0 <= p < n} and {@code 0 <= q < n}
+     */
+    bool connected(int p, int q);
+
+    /**
+     * Returns the number of sets.
+     *
+     * @return the number of sets (between {@code 1} and {@code n})
+     */
+    inline int count() {
+        return thisCount.load(memory_order_acquire);
+    }
+
+    /**
+     * Merges the set containing element {@code p} with the
+     * the set containing element {@code q}.
+     *
+     * @param  p one element
+     * @param  q the other element
+     * @return {@code true} if this call merged two sets; {@code false} if
+     *         {@code p} and {@code q} were already in the same set
+     * @throws invalid_argument unless
+     *         both {@code 0 <= p < n} and {@code 0 <= q < n}
+     */
+    bool concurrentUnion(int p, int q);
+
+    /**
+     * Merges the sets of every pair of elements, splitting the pairs into
+     * chunks that are merged in parallel on the given thread pool.
+     *
+     * @param  pairs the pairs of elements to merge
+     * @param  pool the thread pool that merges the chunks
+     * @throws invalid_argument unless every element of every pair is
+     *         between {@code 0} and {@code n-1}; no pair is merged in that case
+     */
+    void unionBatch(span<const pair<int, int>> pairs, ThreadPool &pool);
+
+private:
+    /// validates that p is a valid index
+    void validate(int p) const;
+
+    /// find and union without validation
+    int root(int p);
+
+    bool link(int p, int q);
+};
+
+#endif //ALGORITHMS_CONCURRENTUF_HPP
@@ -0,0 +1,158 @@
+#ifndef ALGORITHMS_DARYHEAP_HPP
+#define ALGORITHMS_DARYHEAP_HPP
+
+#include <type_traits>          // std::is_arithmetic_v
+#include <bit>                  // std::countr_zero
+#include <utility>              // std::move
+
+using namespace std;
+
+/**
+ *  The heap-ordering routines shared by {@code MinPQ} and {@code MaxPQ}, for
+ *  heaps in which every node has {@code D} children.
+ *
+ *  The nodes are numbered from 1 as in the textbook binary heap: node k has
+ *  the parent (k - 2) / D + 1 and the children D (k - 1) + 2 to D k + 1, so
+ *  for D = 2 these are k / 2 and 2k, 2k + 1. The priority queues keep node k
+ *  at {@code pq[k + D - 2]} of a cache-line aligned array, so the first child
+ *  of every node is at a multiple of D, and the D children of a node share a
+ *  cache line whenever D keys fit in one. A 4-ary or 8-ary heap is half or a
+ *  third as deep as a binary heap, so a sink touches fewer cache lines at the
+ *  cost of comparing more children per level.
+ *
+ *  Each routine orders nodes by {@code before}, which is {@code std::less<T>}
+ *  for a min-heap and {@code std::greater<T>} for a max-heap. Arithmetic keys
+ *  choose the best of D children without a branch per child: the best key is
+ *  a min (or max) reduction over the children, and its position the lowest bit
+ *  of a mask of the children that do not come after it, both of which the
+ *  compiler turns into SIMD instructions. The mask is not one of equal keys,
+ *  which would be empty when a NaN is among the children.
+ *
+ *  The batch routines restore the heap order after many keys have changed at
+ *  once. {@code heapifyRange} sinks only the ancestors of the changed nodes,
+ *  level by level from the bottom, as Floyd's heap construction does for all
+ *  nodes. {@code heapPopK} removes the first k keys one at a time, but moves
+ *  each hole at the root straight down to a leaf and swims the last key up
+ *  from there, as bottom-up heapsort does. The last key nearly always belongs
+ *  near the bottom, so this takes about one compare per level where a sink
+ *  takes two.
+ *
+ *  @author Benjamin Chan
+ */
+
+/**
+ * Returns the parent of node k in a heap of arity {@code D}.
+ */
+template<int D>
+constexpr int heapParent(int k) {
+    return (k - 2) / D + 1;
+}
+
+/**
+ * Returns the first child of node k in a heap of arity {@code D}.
+ */
+template<int D>
+constexpr int heapFirstChild(int k) {
+    return D * (k - 1) + 2;
+}
+
+/**
+ * Returns the node among {@code heap[first..first+D-1]}, of which only those up
+ * to {@code n} exist, that comes first by {@code before}.
+ */
+template<int D, typename T, typename Before>
+int heapBestChild(const T *heap, int first, int n, Before before) {
+    if constexpr (is_arithmetic_v<T> && D > 2) {
+        if (first + D - 1 <= n) {
+            const T *children = heap + first;
+            T best = children[0];
+            for (int i = 1; i < D; i++)
+                best = before(children[i], best) ? children[i] : best;
+            // the child that best came from is not after it, even if it is a NaN, so the mask is never 0
+            unsigned mask = 0;
+            for (int i = 0; i < D; i++)
+                mask |= (unsigned) !before(best, children[i]) << i;
+            return first + countr_zero(mask);
+        }
+    }
+    int best = first;
+    int last = first + D - 1 < n ? first + D - 1 : n;
+    for (int j = first + 1; j <= last; j++)
+        if (before(heap[j], heap[best])) best = j;
+    return best;
+}
+
+/**
+ * Moves node k up until its parent does not come after it by {@code before}.
+ */
+template<int D, typename T, typename Before>
+void heapSwim(T *heap, int k, Before before) {
+    T x = std::move(heap[k]);
+    while (k > 1 && before(x, heap[heapParent<D>(k)])) {
+        heap[k] = std::move(heap[heapParent<D>(k)]);
+        k = heapParent<D>(k);
+    }
+    heap[k] = std::move(x);
+}
+
+/**
+ * Moves node k of the heap {@code heap[1..n]} down until none of its children
+ * comes before it by {@code before}.
+ */
+template<int D, typename T, typename Before>
+void heapSink(T *heap, int k, int n, Before before) {
+    T x = std::move(heap[k]);
+    while (heapFirstChild<D>(k) <= n) {
+        int j = heapBestChild<D>(heap, heapFirstChild<D>(k), n, before);
+        if (!before(heap[j], x)) break;
+        heap[k] = std::move(heap[j]);
+        k = j;
+    }
+    heap[k] = std::move(x);
+}
+
+/**
+ * Restores the heap order of {@code heap[1..n]} after the nodes {@code lo..hi}
+ * have changed, by sinking these nodes and all their ancestors, deepest first.
+ * Takes Θ(hi - lo + log n) sinks; with {@code lo = 1} and {@code hi = n} it is
+ * Floyd's bottom-up heap construction.
+ */
+template<int D, typename T, typename Before>
+void heapifyRange(T *heap, int lo, int hi, int n, Before before) {
+    if (hi > n) hi = n;
+    if (lo > hi) return;
+    while (true) {
+        for (int k = hi; k >= lo; k--)
+            if (heapFirstChild<D>(k) <= n) heapSink<D>(heap, k, n, before);
+        if (lo == 1) return;
+        lo = heapParent<D>(lo);
+        hi = heapParent<D>(hi);
+    }
+}
+
+/**
+ * Removes the first {@code k} nodes of the heap {@code heap[1..n]} by
+ * {@code before}, appends their keys to {@code out} in order, and leaves the
+ * heap order on {@code heap[1..n-k]}.
+ */
+template<int D, typename T, typename Before, typename Out>
+void heapPopK(T *heap, int n, int k, Out &out, Before before) {
+    for (; k > 0; k--, n--) {
+        out.push_back(std::move(heap[1]));
+
+        // the last key almost always belongs near the bottom: move the hole at the root down to a leaf
+        // along the best children without comparing them to that key, then swim the key up from there
+        int hole = 1;
+        while (heapFirstChild<D>(hole) < n) {
+            int j = heapBestChild<D>(heap, heapFirstChild<D>(hole), n - 1, before);
+            heap[hole] = std::move(heap[j]);
+            hole = j;
+        }
+        if (hole < n) {
+            heap[hole] = std::move(heap[n]);
+            heapSwim<D>(heap, hole, before);
+        }
+    }
+}
+
+#endif //ALGORITHMS_DARYHEAP_HPP
@@ -0,0 +1,243 @@
+#ifndef ALGORITHMS_EXTERNALSORT_HPP
+#define ALGORITHMS_EXTERNALSORT_HPP
+
+#include <span>                 // std::span
+#include <vector>               // std::vector
+#include <string>               // std::string
+#include <memory>               // std::unique_ptr
+#include <cstdio>               // std::FILE, std::fopen, std::fread, std::fwrite
+#include <filesystem>           // std::filesystem::temp_directory_path, std::filesystem::remove
+#include <system_error>         // std::error_code
+#include <atomic>               // std::atomic
+#include <functional>           // std::less, std::greater
+#include <type_traits>          // std::is_trivially_copyable_v
+#include <algorithm>            // std::min, std::max
+#include <stdexcept>            // std::invalid_argument, std::runtime_error
+#include <unistd.h>             // getpid
+#include "Comparable.hpp"       // includes Comparable concept used as a constraint
+#include "QuickSort.hpp"        // sorts the runs in memory
+
+using namespace std;
+
+/**
+ *  The {@code ExternalSort} class sorts a file of fixed-width binary records
+ *  that may be much larger than memory, through invoking its constructor with
+ *  the names of the input and output files and a memory budget in bytes.
+ *
+ *  The records are the bytes of items of type T, which must be trivially
+ *  copyable, laid end to end. In the first phase the input is read in chunks
+ *  of as many records as fit in the budget, each chunk is sorted in memory by
+ *  {@code QuickSort} in {@code QuickSortMode::BlockIntrosort}, which needs no
+ *  extra memory, and written to a temporary run file. In the second phase the
+ *  runs are merged k at a time by a tournament (loser) tree, which finds the
+ *  next record with lg k compares. The budget is divided among one read buffer
+ *  per run and the output buffer, so every file is read and written
+ *  sequentially in large blocks; k is the number of buffers of at least 64 KiB
+ *  that fit in the budget, and if there are more runs than that, the merge
+ *  takes more than one pass.
+ *
+ *  This implementation reads and writes every record 1 + ⌈log_k r⌉ times for
+ *  r runs, and makes ~ n lg n compares.
+ *  This sorting algorithm is not stable.
+ *
+ *  @author Benjamin Chan
+ *
+ *  @param <T> the type of a record
+ */
+template<typename T> requires Comparable<T> && is_trivially_copyable_v<T>
+class ExternalSort {
+public:
+    /**
+     * Writes the records of the input file to the output file in ascending order,
+     * or descending order, using at most about {@code memory} bytes for records.
+     *
+     * @param input, the name of the file of records to sort
+     * @param output, the name of the file to write the sorted records to
+     * @param memory, the memory budget in bytes
+     * @param a boolean specifying whether it should be reverse
+     * @param tempDirectory, the directory in which to keep the runs
+     * @throws invalid_argument if the input file cannot be opened or is not a whole number of records,
+     *         or if the budget is smaller than a record
+     * @throws runtime_error if a file cannot be written
+     */
+    explicit ExternalSort<T>(const string &input, const string &output, size_t memory, bool reverse = false,
+                             const string &tempDirectory = filesystem::temp_directory_path().string()) {
+        if (memory < sizeof(T)) throw invalid_argument("the memory budget is smaller than a record");
+        sort(input, output, memory / sizeof(T), tempDirectory, reverse);
+    };
+
+    /// Returns the number of sorted runs that the first phase wrote
+    int runs() const {
+        return runCount;
+    }
+
+    /// Returns the number of merge passes of the second phase
+    int passes() const {
+        return passCount;
+    }
+
+private:
+    // the smallest read or write buffer of the merge
+    static constexpr size_t MIN_BUFFER_BYTES = 1 << 16;
+
+    struct FileCloser {
+        void operator()(FILE *file) const {
+            fclose(file);
+        }
+    };
+
+    using File = unique_ptr<FILE, FileCloser>;
+
+    // the names of temporary files, which are removed when it goes out of scope, so that an exception
+    // does not leave the runs behind
+    struct TempFiles {
+        vector<string> names;
+
+        ~TempFiles() {
+            error_code ignored;
+            for (const string &name: names) filesystem::remove(name, ignored);
+        }
+    };
+
+    int runCount = 0;
+    int passCount = 0;
+
+    // sort the input file through runs of the given number of records
+    void sort(const string &input, const string &output, size_t records, const string &tempDirectory, bool reverse);
+
+    // merge the run files into the output file, with a read buffer of the given number of records per run
+    template<typename Less>
+    static void merge(span<const string> runs, const string &output, size_t buffer, Less less);
+
+    // open a file, throwing if it cannot be opened
+    static File openFile(const string &path, const char *mode);
+
+    // the name of a new temporary file in the directory
+    static string tempName(const string &tempDirectory);
+};
+
+template<typename T>
+requires Comparable<T> && is_trivially_copyable_v<T>
+void ExternalSort<T>::sort(const string &input, const string &output, size_t records, const string &tempDirectory,
+                           bool reverse) {
+    // phase one: sort chunks that fit in the budget into runs
+    TempFiles runs;
+    {
+        File in(fopen(input.c_str(), "rb"));
+        if (!in) throw invalid_argument("could not open " + input);
+        vector<T> chunk(records);
+        while (true) {
+            size_t bytes = fread(chunk.data(), 1, records * sizeof(T), in.get());
+            if (bytes % sizeof(T) != 0) throw invalid_argument(input + " is not a whole number of records");
+            size_t n = bytes / sizeof(T);
+            if (n == 0) break;
+            QuickSort<T>{span<T>(chunk.data(), n), QuickSortMode::BlockIntrosort, reverse};
+            runs.names.push_back(tempName(tempDirectory));
+            File out = openFile(runs.names.back(), "wb");
+            if (fwrite(chunk.data(), sizeof(T), n, out.get()) != n)
+                throw runtime_error("could not write " + runs.names.back());
+            if (n < records) break;
+        }
+    }
+    runCount = runs.names.size();
+
+    // phase two: merge k runs at a time until one is left; k + 1 buffers must fit in the budget, and a budget
+    // of fewer than three minimum buffers still merges two at a time with smaller ones
+    size_t minBuffer = max<size_t>(1, MIN_BUFFER_BYTES / sizeof(T));
+    size_t k = records / minBuffer > 2 ? records / minBuffer - 1 : 2;
+    while (true) {
+        bool last = runs.names.size() <= k;
+        TempFiles merged;
+        for (size_t first = 0; first < runs.names.size() || first == 0; first += k) {
+            size_t count = min(k, runs.names.size() - first);
+            if (!last) merged.names.push_back(tempName(tempDirectory));
+            const string &name = last ? output : merged.names.back();
+            span<const string> group(runs.names.data() + first, count);
+            size_t buffer = max<size_t>(1, records / (count + 1));
+            if (!reverse) merge(group, name, buffer, std::less<T>());
+            else merge(group, name, buffer, std::greater<T>());
+            for (const string &run: group) filesystem::remove(run);
+            if (last) break;
+        }
+        passCount++;
+        runs.names.swap(merged.names);
+        if (last) break;
+    }
+}
+
+template<typename T>
+requires Comparable<T> && is_trivially_copyable_v<T>
+template<typename Less>
+void ExternalSort<T>::merge(span<const string> runs, const string &output, size_t buffer, Less less) {
+    int k = runs.size();
+    if (k == 0) {
+        openFile(output, "wb");
+        return;
+    }
+
+    // the buffered head of every run
+    vector<File> files;
+    vector<vector<T>> buffers(k, vector<T>(buffer));
+    vector<size_t> pos(k), size(k);
+    for (int i = 0; i < k; i++) files.push_back(openFile(runs[i], "rb"));
+    auto refill = [&](int i) {
+        pos[i] = 0;
+        size[i] = fread(buffers[i].data(), sizeof(T), buffer, files[i].get());
+    };
+    for (int i = 0; i < k; i++) refill(i);
+
+    // does run x win over run y; an exhausted run loses, and -1 wins over every run
+    auto wins = [&](int x, int y) {
+        if (x < 0) return true;
+        if (y < 0) return false;
+        if (pos[x] == size[x]) return false;
+        if (pos[y] == size[y]) return true;
+        return !less(buffers[y][pos[y]], buffers[x][pos[x]]);
+    };
+
+    // tree[1..k-1] are the losers of the matches at the internal nodes, tree[0] the overall winner
+    vector<int> tree(k, -1);
+    auto replay = [&](int winner) {
+        for (int t = (winner + k) / 2; t > 0; t /= 2)
+            if (wins(tree[t], winner)) swap(tree[t], winner);
+        tree[0] = winner;
+    };
+    for (int i = k - 1; i >= 0; i--) replay(i);
+
+    File out = openFile(output, "wb");
+    vector<T> outBuffer(buffer);
+    size_t n = 0;
+    auto flush = [&] {
+        if (fwrite(outBuffer.data(), sizeof(T), n, out.get()) != n) throw runtime_error("could not write " + output);
+        n = 0;
+    };
+    while (true) {
+        int w = tree[0];
+        if (pos[w] == size[w]) break;
+        outBuffer[n++] = buffers[w][pos[w]++];
+        if (n == buffer) flush();
+        if (pos[w] == size[w]) refill(w);
+        replay(w);
+    }
+    flush();
+}
+
+template<typename T>
+requires Comparable<T> && is_trivially_copyable_v<T>
+typename ExternalSort<T>::File ExternalSort<T>::openFile(const string &path, const char *mode) {
+    File file(fopen(path.c_str(), mode));
+    if (!file) throw runtime_error("could not open " + path);
+    // the merge does its own buffering
+    setvbuf(file.get(), nullptr, _IONBF, 0);
+    return file;
+}
+
+template<typename T>
+requires Comparable<T> && is_trivially_copyable_v<T>
+string ExternalSort<T>::tempName(const string &tempDirectory) {
+    static atomic<int> count = 0;
+    string name = "ExternalSort-" + to_string(getpid()) + "-" + to_string(count++) + ".run";
+    return (filesystem::path(tempDirectory) / name).string();
+}
+
+#endif //ALGORITHMS_EXTERNALSORT_HPP
@@ -0,0 +1,141 @@
+#ifndef ALGORITHMS_EYTZINGERINDEX_HPP
+#define ALGORITHMS_EYTZINGERINDEX_HPP
+
+#include <span>                     // std::span
+#include <vector>                   // std::vector
+#include <bit>                      // std::countr_one, std::bit_floor
+#include <algorithm>                // std::max, std::is_sorted
+#include <cstddef>                  // std::size_t
+#include <type_traits>              // std::remove_const_t
+#include "Comparable.hpp"           // includes Comparable concept used as a constraint
+#include "PoolAllocator.hpp"        // includes CacheAlignedAllocator
+#include <cassert>                  // std::assert
+
+using namespace std;
+
+/**
+ *  The {@code EytzingerIndex} class is a static search index over a sorted
+ *  array, which answers the index-of, rank and lower-bound queries of binary
+ *  search. It is built once, and is meant for tables that are searched many
+ *  more times than they change.
+ *
+ *  This implementation copies the keys into the Eytzinger layout: the
+ *  breadth-first order of the implicit binary search tree, in which node k has
+ *  the children 2k and 2k + 1, as in a binary heap. A search descends from the
+ *  root with {@code k = 2k + (a[k] < key)}, a loop without a data-dependent
+ *  branch, so it never mispredicts. The first levels of the tree share a few
+ *  cache lines that stay in cache, and the 16 descendants of a node four
+ *  levels down (for 4-byte keys) are adjacent in one cache line, which the
+ *  search prefetches four levels ahead. A binary search on a sorted array
+ *  instead touches a new cache line at nearly every level once the array is
+ *  larger than the cache, and waits for each one. The position of every key in
+ *  the sorted array is stored beside the layout, so the index takes about
+ *  twice the memory of the keys.
+ *
+ *  The constructor takes Θ(n) time. The index-of, rank and lower-bound
+ *  operations take Θ(log(n)) time in the worst case.
+ *
+ *  @author Benjamin Chan
+ *
+ *  @param <T> the generic type of a key
+ */
+template<typename T> requires Comparable<T>
+class EytzingerIndex {
+public:
+    /**
+     * Builds the index over the keys of a sorted array.
+     *
+     * @param  sorted the keys, which must be in ascending order
+     */
+    explicit EytzingerIndex(span<const T> sorted) : n((int) sorted.size()), keys(sorted.size() + 1),
+                                                    positions(sorted.size() + 1) {
+        assert(is_sorted(sorted.begin(), sorted.end()));
+        int next = 0;
+        build(sorted, 1, next);
+    }
+
+    /**
+     * Returns the number of keys in the index.
+     *
+     * @return the number of keys in the index
+     */
+    int size() const {
+        return n;
+    }
+
+    /**
+     * Returns the number of keys in the index that are strictly less than {@code key}.
+     *
+     * @param  key the key
+     * @return the number of keys in the index that are strictly less than {@code key}
+     */
+    int rank(const T &key) const {
+        int k = lowerBoundNode(key);
+        return k == 0 ? n : positions[k];
+    }
+
+    /**
+     * Returns the index in the sorted array of the first key that is not less
+     * than {@code key}, which is the same as its rank.
+     *
+     * @param  key the key
+     * @return the index of the first key not less than {@code key}, or {@code size()} if there is none
+     */
+    int lowerBound(const T &key) const {
+        return rank(key);
+    }
+
+    /**
+     * Returns the index of the specified key in the sorted array; the first
+     * one, if the key is there more than once.
+     *
+     * @param  key the search key
+     * @return index of key in the sorted array if present; {@code -1} otherwise
+     */
+    int indexOf(const T &key) const {
+        int k = lowerBoundNode(key);
+        return k != 0 && !(key < keys[k]) ? positions[k] : -1;
+    }
+
+private:
+    // the number of keys in a cache line, and so the distance in nodes between a node and the first
+    // of its descendants that the search prefetches
+    static constexpr size_t BLOCK = bit_floor(max<size_t>(1, CacheAlignedAllocator<T>::CACHE_LINE / sizeof(T)));
+
+    int n;                                          // the number of keys
+    vector<T, CacheAlignedAllocator<T>> keys;       // keys[1..n] in Eytzinger order; keys[0] is unused
+    vector<int> positions;                          // positions[k] is the index in the sorted array of keys[k]
+
+    // fill the subtree rooted at node k with the next keys of the sorted array, in order
+    void build(span<const T> sorted, int k, int &next) {
+        if (k > n) return;
+        build(sorted, 2 * k, next);
+        keys[k] = sorted[next];
+        positions[k] = next++;
+        build(sorted, 2 * k + 1, next);
+    }
+
+    // the node of the first key not less than key, or 0 if there is none
+    int lowerBoundNode(const T &key) const {
+        const T *a = keys.data();
+        size_t k = 1;
+        while (k <= (size_t) n) {
+            __builtin_prefetch(a + k * BLOCK);
+            k = 2 * k + (a[k] < key);
+        }
+
+        // every 1 bit below the last 0 bit is a step right, past a key less than key; the node
+        // of the last step left is the answer
+        k >>= countr_one(k) + 1;
+        return (int) k;
+    }
+};
+
+/// Uses type deduction for the constructor
+template<typename T>
+EytzingerIndex(vector<T>)->EytzingerIndex<T>;
+
+template<typename T>
+EytzingerIndex(span<T>)->EytzingerIndex<remove_const_t<T>>;
+
+#endif //ALGORITHMS_EYTZINGERINDEX_HPP
@@ -0,0 +1,140 @@
+#include "In.hpp"
+
+#include <array>
+#include <climits>
+#include <iostream>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace {
+    // whitespace[c] is true for the characters that separate tokens
+    constexpr array<bool, 256> whitespace = [] {
+        array<bool, 256> table{};
+        for (unsigned char c: {' ', '\t', '\n', '\r', '\v', '\f'})
+            table[c] = true;
+        return table;
+    }();
+
+    inline bool isWhitespace(char c) {
+        return whitespace[static_cast<unsigned char>(c)];
+    }
+}
+
+In::In(const string &path) : data(nullptr), length(0) {
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) throw invalid_argument("could not open " + path);
+    struct stat info{};
+    if (fstat(fd, &info) < 0) {
+        close(fd);
+        throw invalid_argument("could not read " + path);
+    }
+    length = info.st_size;
+    if (length > 0) {
+        void *mapping = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (mapping == MAP_FAILED) {
+            close(fd);
+            throw invalid_argument("could not map " + path);
+        }
+        madvise(mapping, length, MADV_SEQUENTIAL);
+        data = static_cast<const char *>(mapping);
+    }
+    // the mapping stays valid after the descriptor is closed
+    close(fd);
+    pos = data;
+    end = data + length;
+}
+
+In::~In() {
+    if (data != nullptr) munmap(const_cast<char *>(data), length);
+}
+
+bool In::skipWhitespace() {
+    while (pos < end && isWhitespace(*pos)) pos++;
+    return pos < end;
+}
+
+bool In::isEmpty() {
+    return !skipWhitespace();
+}
+
+int In::parseInt() {
+    const char *start = pos;
+    bool negative = *pos == '-';
+    if (negative || *pos == '+') pos++;
+
+    // accumulate digits in a wider type so that overflow can be detected afterwards; leading zeros do not count
+    // towards the 11 digits that it can hold
+    long long value = 0;
+    const char *digits = pos;
+    while (pos < end && *pos == '0') pos++;
+    const char *significant = pos;
+    unsigned int digit;
+    while (pos < end && (digit = static_cast<unsigned char>(*pos) - '0') < 10 && pos - significant < 11) {
+        value = value * 10 + digit;
+        pos++;
+    }
+    if (negative) value = -value;
+
+    if (pos == digits || (pos < end && !isWhitespace(*pos)) || value < INT_MIN || value > INT_MAX) {
+        const char *tokenEnd = pos;
+        while (tokenEnd < end && !isWhitespace(*tokenEnd)) tokenEnd++;
+        throw invalid_argument("'" + string(start, tokenEnd) + "' is not an integer");
+    }
+    return (int) value;
+}
+
+int In::readInt() {
+    try {
+        if (!skipWhitespace()) throw NoSuchElementException();
+        return parseInt();
+    }
+    catch (NoSuchElementException &e) {
+        std::cout << "NoSuchElementException encountered: ";
+        std::cout << e.what() << std::endl;
+        return 0;
+    }
+}
+
+string_view In::readString() {
+    try {
+        if (!skipWhitespace()) throw NoSuchElementException();
+        const char *start = pos;
+        while (pos < end && !isWhitespace(*pos)) pos++;
+        return {start, static_cast<size_t>(pos - start)};
+    }
+    catch (NoSuchElementException &e) {
+        std::cout << "NoSuchElementException encountered: ";
+        std::cout << e.what() << std::endl;
+        return {};
+    }
+}
+
+vector<int> In::readAllInts() {
+    vector<int> values;
+    while (skipWhitespace())
+        values.push_back(parseInt());
+    return values;
+}
+
+vector<pair<int, int>> In::readAllIntPairs() {
+    vector<pair<int, int>> pairs;
+    while (skipWhitespace()) {
+        int p = parseInt();
+        if (!skipWhitespace()) throw invalid_argument("the last pair is missing its second integer");
+        int q = parseInt();
+        pairs.emplace_back(p, q);
+    }
+    return pairs;
+}
+
+vector<string_view> In::readAllStrings() {
+    vector<string_view> tokens;
+    while (skipWhitespace()) {
+        const char *start = pos;
+        while (pos < end && !isWhitespace(*pos)) pos++;
+        tokens.emplace_back(start, static_cast<size_t>(pos - start));
+    }
+    return tokens;
+}
@@ -0,0 +1,139 @@
+#ifndef ALGORITHMS_IN_HPP
+#define ALGORITHMS_IN_HPP
+
+#include <cstddef>                  // std::size_t
+#include <string>                   // std::string
+#include <string_view>              // std::string_view
+#include <utility>                  // std::pair
+#include <vector>                   // std::vector
+#include <exception>                // std::exception
+#include <stdexcept>                // std::invalid_argument
+
+using namespace std;
+
+/**
+ *  The {@code In} class provides methods for reading integers and
+ *  whitespace-separated strings from a file.
+ *
+ *  This implementation maps the whole file into memory and parses it in place,
+ *  instead of copying it through a stream buffer and locale-aware extraction.
+ *  Strings are returned as {@code string_view}s of the mapping, so reading a
+ *  token never allocates; the views remain valid for as long as the
+ *  {@code In} object that produced them. Whitespace is recognized through a
+ *  lookup table and digits through a single unsigned comparison, so the
+ *  scanner takes one well-predicted branch per character.
+ *
+ *  The bulk readers return containers that the rest of the library consumes
+ *  directly: a {@code vector<int>} or {@code vector<string_view>} can be passed
+ *  to the sorts and to the priority queue constructors, and the pairs of
+ *  {@code readAllIntPairs()} to {@code WeightedQuickUnionUF} and
+ *  {@code ConcurrentUF::unionBatch}:
+ *
+ *      In in("./Test Files/large_UF.txt");
+ *      WeightedQuickUnionUF uf(in.readInt());
+ *      for (auto [p, q]: in.readAllIntPairs()) uf.weightedUnion(p, q);
+ *
+ *  @author Benjamin Chan
+ *
+ *  Adapted from Algorithms, 4th edition, {@authors Robert Sedgewick and Kevin Wayne}
+ *  and their booksite https://algs4.cs.princeton.edu/
+ *
+ *  The Java program from which this C++ code was adapted from is found at
+ *  https://algs4.cs.princeton.edu/code/edu/princeton/cs/algs4/In.java.html.
+ */
+class In {
+    /**
+     * @def the NoSuchElementException if there are no tokens left in the file
+     * when using the readInt() and readString() methods
+     */
+    struct NoSuchElementException : public std::exception {
+        const char *what() {
+            return "attempts to read past the end of the input";
+        }
+    };
+
+public:
+    /**
+     * Maps the file with the given name into memory.
+     *
+     * @param  path the name of the file
+     * @throws invalid_argument if the file cannot be opened or mapped
+     */
+    explicit In(const string &path);
+
+    /// Prevents the invocation of the constructor with an lvalue input
+    In(const In &other) = delete;
+
+    /// Prevents the invocation of the constructor with an rvalue input
+    In(In &&other) = delete;
+
+    /// Destructor unmaps the file
+    ~In();
+
+    /**
+     * Returns true if there are no more tokens in the file.
+     *
+     * @return {@code true} if only whitespace remains; {@code false} otherwise
+     */
+    bool isEmpty();
+
+    /**
+     * Reads the next token and returns it as an integer.
+     *
+     * @return the next integer in the file
+     * @throws NoSuchElementException if the file has no more tokens
+     * @throws invalid_argument if the next token is not an integer
+     */
+    int readInt();
+
+    /**
+     * Reads the next token and returns it as a view of the file.
+     *
+     * @return the next token in the file
+     * @throws NoSuchElementException if the file has no more tokens
+     */
+    string_view readString();
+
+    /**
+     * Reads all remaining tokens as integers.
+     *
+     * @return the remaining integers in the file
+     * @throws invalid_argument if a remaining token is not an integer
+     */
+    vector<int> readAllInts();
+
+    /**
+     * Reads all remaining tokens as pairs of integers.
+     *
+     * @return the remaining integers in the file, paired in order
+     * @throws invalid_argument if a remaining token is not an integer or
+     *         the number of remaining tokens is odd
+     */
+    vector<pair<int, int>> readAllIntPairs();
+
+    /**
+     * Reads all remaining tokens as views of the file.
+     *
+     * @return the remaining tokens in the file
+     */
+    vector<string_view> readAllStrings();
+
+private:
+    /// the mapping and its length
+    const char *data;
+    size_t length;
+
+    /// the next unread character
+    const char *pos;
+
+    /// one past the last character
+    const char *end;
+
+    /// skips whitespace; returns false at the end of the file
+    bool skipWhitespace();
+
+    /// parses the integer at pos, which must not be whitespace
+    int parseInt();
+};
+
+#endif //ALGORITHMS_IN_HPP
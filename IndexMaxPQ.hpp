@@ -0,0 +1,332 @@
+#ifndef ALGORITHMS_INDEXMAXPQ_HPP
+#define ALGORITHMS_INDEXMAXPQ_HPP
+
+#include <vector>                   // std::vector
+#include <string>                   // std::string, std::to_string
+#include <sstream>                  // std::stringstream
+#include <stdexcept>                // std::invalid_argument
+#include "Comparable.hpp"           // includes Comparable concept used as a constraint
+#include <boost/lexical_cast.hpp>   // boost::lexical_cast
+
+using namespace std;
+
+/**
+ *  The {@code IndexMaxPQ} class represents an indexed priority queue of generic keys.
+ *  It supports the usual insert and delete-the-maximum
+ *  operations, along with delete and change-the-key
+ *  methods. In order to let the client refer to keys on the priority queue,
+ *  an integer between {@code 0} and {@code maxN - 1}
+ *  is associated with each key—the client uses this integer to specify
+ *  which key to delete or change.
+ *  It also supports methods for peeking at the maximum key,
+ *  testing if the priority queue is empty, and iterating through
+ *  the keys.
+ *
+ *  This implementation uses a binary heap along with an array to associate
+ *  keys with integers in the given range: {@code pq[]} is the heap of indices,
+ *  {@code qp[]} the position of every index in the heap, or -1, and
+ *  {@code keys[]} the key of every index.
+ *  The insert, delete-the-maximum, delete, change-key, decrease-key,
+ *  and increase-key operations take Θ(log(n)) time in the worst case,
+ *  where n is the number of elements in the priority queue.
+ *  The is-empty, size, max-index, max-key, contains and key-of
+ *  operations take Θ(1) time in the worst case.
+ *  Construction takes time proportional to the specified capacity.
+ *
+ *  @author Benjamin Chan
+ *
+ *  Adapted from Algorithms, 4th edition, {@authors Robert Sedgewick and Kevin Wayne}
+ *  and their booksite https://algs4.cs.princeton.edu/
+ *
+ *  The Java program from which this C++ code was adapted from is found at
+ *  https://algs4.cs.princeton.edu/24pq/IndexMaxPQ.java.html.
+ *
+ *  @param <T> the generic type of key on this priority queue
+ */
+template<typename T> requires Comparable<T>
+class IndexMaxPQ {
+public:
+    /**
+     * Initializes an empty indexed priority queue with indices between {@code 0}
+     * and {@code maxN - 1}.
+     *
+     * @param  maxN the keys on this priority queue are index from {@code 0} {@code maxN - 1}
+     * @throws invalid_argument if {@code maxN < 0}
+     */
+    explicit IndexMaxPQ(int maxN) {
+        if (maxN < 0) throw invalid_argument("maxN is negative");
+        this->maxN = maxN;
+        n = 0;
+        keys = vector<T>(maxN + 1);
+        pq = vector<int>(maxN + 1);
+        qp = vector<int>(maxN + 1, -1);
+    }
+
+    /**
+     * Returns true if this priority queue is empty.
+     *
+     * @return {@code true} if this priority queue is empty;
+     *         {@code false} otherwise
+     */
+    bool isEmpty() const {
+        return n == 0;
+    }
+
+    /**
+     * Is {@code i} an index on this priority queue?
+     *
+     * @param  i an index
+     * @return {@code true} if {@code i} is an index on this priority queue;
+     *         {@code false} otherwise
+     * @throws invalid_argument unless {@code 0 <= i < maxN}
+     */
+    bool contains(int i) const {
+        validateIndex(i);
+        return qp[i] != -1;
+    }
+
+    /**
+     * Returns the number of keys on this priority queue.
+     *
+     * @return the number of keys on this priority queue
+     */
+    int size() const {
+        return n;
+    }
+
+    /**
+     * Associates key with index {@code i}.
+     *
+     * @param  i an index
+     * @param  key the key to associate with index {@code i}
+     * @throws invalid_argument unless {@code 0 <= i < maxN}
+     * @throws invalid_argument if there already is an item associated
+     *         with index {@code i}
+     */
+    void insert(int i, T key) {
+        validateIndex(i);
+        if (contains(i)) throw invalid_argument("index is already in the priority queue");
+        n++;
+        qp[i] = n;
+        pq[n] = i;
+        keys[i] = key;
+        swim(n);
+    }
+
+    /**
+     * Returns an index associated with a maximum key.
+     *
+     * @return an index associated with a maximum key
+     * @throws NoSuchElementException if this priority queue is empty
+     */
+    int maxIndex() const {
+        if (n == 0) throw NoSuchElementException();
+        return pq[1];
+    }
+
+    /**
+     * Returns a maximum key.
+     *
+     * @return a maximum key
+     * @throws NoSuchElementException if this priority queue is empty
+     */
+    T maxKey() const {
+        if (n == 0) throw NoSuchElementException();
+        return keys[pq[1]];
+    }
+
+    /**
+     * Removes a maximum key and returns its associated index.
+     *
+     * @return an index associated with a maximum key
+     * @throws NoSuchElementException if this priority queue is empty
+     */
+    int delMax() {
+        if (n == 0) throw NoSuchElementException();
+        int max = pq[1];
+        exch(1, n--);
+        sink(1);
+        qp[max] = -1;           // delete
+        keys[max] = T();        // to avoid loitering
+        pq[n + 1] = -1;         // not needed
+        return max;
+    }
+
+    /**
+     * Returns the key associated with index {@code i}.
+     *
+     * @param  i the index of the key to return
+     * @return the key associated with index {@code i}
+     * @throws invalid_argument unless {@code 0 <= i < maxN}
+     * @throws NoSuchElementException no key is associated with index {@code i}
+     */
+    T keyOf(int i) const {
+        validateIndex(i);
+        if (!contains(i)) throw NoSuchElementException();
+        return keys[i];
+    }
+
+    /**
+     * Change the key associated with index {@code i} to the specified value.
+     *
+     * @param  i the index of the key to change
+     * @param  key change the key associated with index {@code i} to this key
+     * @throws invalid_argument unless {@code 0 <= i < maxN}
+     * @throws NoSuchElementException no key is associated with index {@code i}
+     */
+    void changeKey(int i, T key) {
+        validateIndex(i);
+        if (!contains(i)) throw NoSuchElementException();
+        keys[i] = key;
+        swim(qp[i]);
+        sink(qp[i]);
+    }
+
+    /**
+     * Decrease the key associated with index {@code i} to the specified value.
+     *
+     * @param  i the index of the key to decrease
+     * @param  key decrease the key associated with index {@code i} to this key
+     * @throws invalid_argument unless {@code 0 <= i < maxN}
+     * @throws invalid_argument if {@code key >= keyOf(i)}
+     * @throws NoSuchElementException no key is associated with index {@code i}
+     */
+    void decreaseKey(int i, T key) {
+        validateIndex(i);
+        if (!contains(i)) throw NoSuchElementException();
+        if (keys[i] == key)
+            throw invalid_argument("Calling decreaseKey() with a key equal to the key in the priority queue");
+        if (keys[i] < key)
+            throw invalid_argument(
+                    "Calling decreaseKey() with a key strictly greater than the key in the priority queue");
+        keys[i] = key;
+        sink(qp[i]);
+    }
+
+    /**
+     * Increase the key associated with index {@code i} to the specified value.
+     *
+     * @param  i the index of the key to increase
+     * @param  key increase the key associated with index {@code i} to this key
+     * @throws invalid_argument unless {@code 0 <= i < maxN}
+     * @throws invalid_argument if {@code key <= keyOf(i)}
+     * @throws NoSuchElementException no key is associated with index {@code i}
+     */
+    void increaseKey(int i, T key) {
+        validateIndex(i);
+        if (!contains(i)) throw NoSuchElementException();
+        if (keys[i] == key)
+            throw invalid_argument("Calling increaseKey() with a key equal to the key in the priority queue");
+        if (keys[i] > key)
+            throw invalid_argument(
+                    "Calling increaseKey() with a key strictly less than the key in the priority queue");
+        keys[i] = key;
+        swim(qp[i]);
+    }
+
+    /**
+     * Remove the key associated with index {@code i}; {@code delete} in the Java original.
+     *
+     * @param  i the index of the key to remove
+     * @throws invalid_argument unless {@code 0 <= i < maxN}
+     * @throws NoSuchElementException no key is associated with index {@code i}
+     */
+    void remove(int i) {
+        validateIndex(i);
+        if (!contains(i)) throw NoSuchElementException();
+        int index = qp[i];
+        exch(index, n--);
+        swim(index);
+        sink(index);
+        keys[i] = T();
+        qp[i] = -1;
+    }
+
+    /**
+      * Returns a string representation of this indexed priority queue.
+      *
+      * @return the sequence of indices in descending order of their keys, separated by spaces
+      */
+    [[nodiscard]] std::string toString() const;
+
+    /**
+     * @def the NoSuchElementException if there are no items in the priority queue, or no key
+     * is associated with an index
+     */
+    struct NoSuchElementException : public std::exception {
+        [[nodiscard]] const char *what() const noexcept override {
+            return "Priority Queue Underflow";
+        }
+    };
+
+private:
+    int maxN;                   // maximum number of elements on PQ
+    int n;                      // number of elements on PQ
+    vector<int> pq;             // binary heap using 1-based indexing
+    vector<int> qp;             // inverse of pq - qp[pq[i]] = pq[qp[i]] = i
+    vector<T> keys;             // keys[i] = priority of i
+
+    void validateIndex(int i) const {
+        if (i < 0) throw invalid_argument("index is negative: " + to_string(i));
+        if (i >= maxN) throw invalid_argument("index >= capacity: " + to_string(i));
+    }
+
+    /***************************************************************************
+     * General helper functions.
+     ***************************************************************************/
+
+    bool less(int i, int j) const {
+        return keys[pq[i]] < keys[pq[j]];
+    }
+
+    void exch(int i, int j) {
+        int swap = pq[i];
+        pq[i] = pq[j];
+        pq[j] = swap;
+        qp[pq[i]] = i;
+        qp[pq[j]] = j;
+    }
+
+    /***************************************************************************
+     * Heap helper functions.
+     ***************************************************************************/
+
+    void swim(int k) {
+        while (k > 1 && less(k / 2, k)) {
+            exch(k, k / 2);
+            k = k / 2;
+        }
+    }
+
+    void sink(int k) {
+        while (2 * k <= n) {
+            int j = 2 * k;
+            if (j < n && less(j, j + 1)) j++;
+            if (!less(k, j)) break;
+            exch(k, j);
+            k = j;
+        }
+    }
+};
+
+template<typename T>
+requires Comparable<T>
+std::string IndexMaxPQ<T>::toString() const {
+    std::stringstream ss;
+    IndexMaxPQ<T> copy(maxN);
+    for (int i = 1; i <= n; i++)
+        copy.insert(pq[i], keys[pq[i]]);
+    while (!copy.isEmpty()) {
+        ss << boost::lexical_cast<std::string>(copy.delMax()) << " ";
+    }
+    ss << endl;
+    return ss.str();
+}
+
+/// Overloads the "<<" operator for an indexed priority queue
+template<typename T>
+std::ostream &operator<<(std::ostream &os, const IndexMaxPQ<T> &indexMaxPQ) {
+    return os << indexMaxPQ.toString();
+}
+
+#endif //ALGORITHMS_INDEXMAXPQ_HPP
@@ -0,0 +1,224 @@
+#ifndef ALGORITHMS_LSD_HPP
+#define ALGORITHMS_LSD_HPP
+
+#include <span>                 // std::span
+#include <array>                // std::array
+#include <vector>               // std::vector
+#include <string>               // std::string
+#include <string_view>          // std::string_view
+#include <concepts>             // std::integral, std::invocable
+#include <type_traits>          // std::make_unsigned_t, std::invoke_result_t
+#include <algorithm>            // std::move
+#include <stdexcept>            // std::invalid_argument
+#include <cassert>              // std::assert
+
+using namespace std;
+
+/**
+ *  The {@code LSD} class provides methods for sorting a container of integers,
+ *  of fixed-width strings, or of records by an integer field, using LSD radix
+ *  sort. Unlike the other sorts, it never compares two keys: it distributes the
+ *  items by one digit of their keys at a time, from the least significant digit
+ *  to the most, with a stable key-indexed counting pass per digit.
+ *
+ *  Integer keys are split into 8-bit digits if they are at most 16 bits wide
+ *  and into 11-bit digits otherwise, so a 32-bit key takes 3 passes and a
+ *  64-bit key 6. The counts of every digit are taken in a single read of the
+ *  input, the passes move the items back and forth between the container and
+ *  one auxiliary array, and a pass whose digit is the same for every key is
+ *  skipped, so keys that only use their low bits take fewer passes. Signed
+ *  keys are ordered by flipping their sign bit.
+ *
+ *  This implementation takes Θ(w * (n + R)) time to sort n keys of w digits
+ *  of radix R, and uses Θ(n + w * R) extra memory.
+ *  This sorting algorithm is stable.
+ *
+ *  @author Benjamin Chan
+ *
+ *  Adapted from Algorithms, 4th edition, {@authors Robert Sedgewick and Kevin Wayne}
+ *  and their booksite https://algs4.cs.princeton.edu/
+ *
+ *  The Java program from which this C++ code was adapted from is found at
+ *  https://algs4.cs.princeton.edu/51radix/LSD.java.html.
+ *
+ *  @param <T> the generic type of an item in this sorting algorithm
+ */
+template<typename T>
+class LSD {
+public:
+    /**
+     * Rearranges the container of integers in ascending order, or descending order.
+     *
+     * @param a, the container to be sorted
+     * @param a boolean specifying whether it should be reverse
+     */
+    explicit LSD<T>(span<T> a, bool reverse = false) requires integral<T> {
+        sortIntegers(a, [](const T &x) { return x; }, reverse);
+        assert(isSorted(a, [](const T &x) { return x; }, reverse));
+    };
+
+    /**
+     * Rearranges the container of strings in ascending order, or descending order,
+     * of their first {@code w} characters.
+     *
+     * @param a, the container to be sorted
+     * @param w, the number of characters of every string to sort on
+     * @param a boolean specifying whether it should be reverse
+     * @throws invalid_argument if a string is shorter than {@code w} characters
+     */
+    explicit LSD<T>(span<T> a, int w, bool reverse = false) requires same_as<T, string> || same_as<T, string_view> {
+        for (const T &s: a)
+            if ((int) s.size() < w) throw invalid_argument("'" + string(s) + "' is shorter than " + to_string(w));
+        auto digit = [w](const T &s, int d) { return (int) (unsigned char) s[w - 1 - d]; };
+        radixSort(a, w, 256, digit, reverse);
+        assert(isSorted(a, [w](const T &s) { return string_view(s).substr(0, w); }, reverse));
+    };
+
+    /**
+     * Rearranges the container in ascending order, or descending order, of the
+     * integer that {@code key} extracts from every item.
+     *
+     * @param a, the container to be sorted
+     * @param key, the function that returns the integer key of an item
+     * @param a boolean specifying whether it should be reverse
+     */
+    template<typename KeyOf>
+    requires integral<decay_t<invoke_result_t<KeyOf &, const T &>>>
+    explicit LSD<T>(span<T> a, KeyOf key, bool reverse = false) {
+        sortIntegers(a, key, reverse);
+        assert(isSorted(a, key, reverse));
+    };
+
+private:
+    // sorts by the integer keys, in digits of 8 bits for keys of up to 16 bits and of 11 bits otherwise
+    template<typename KeyOf>
+    static void sortIntegers(span<T> a, KeyOf key, bool reverse);
+
+    // sorts by the digits 0 (least significant) to passes - 1 of radix R
+    template<typename DigitOf>
+    static void radixSort(span<T> a, int passes, int R, DigitOf digit, bool reverse);
+
+    // check if container is sorted by the given key -- useful for debugging
+    template<typename KeyOf>
+    static bool isSorted(span<T> a, KeyOf key, bool reverse);
+};
+
+template<typename T>
+template<typename KeyOf>
+void LSD<T>::sortIntegers(span<T> a, KeyOf key, bool reverse) {
+    using Key = decay_t<invoke_result_t<KeyOf &, const T &>>;
+    using Unsigned = make_unsigned_t<Key>;
+    constexpr int BITS_PER_KEY = 8 * sizeof(Key);
+    constexpr int BITS = BITS_PER_KEY <= 16 ? 8 : 11;
+    constexpr int PASSES = (BITS_PER_KEY + BITS - 1) / BITS;
+    constexpr Unsigned MASK = (1 << BITS) - 1;
+
+    // flip the sign bit so that negative keys come first
+    constexpr Unsigned SIGN = is_signed_v<Key> ? (Unsigned) 1 << (BITS_PER_KEY - 1) : 0;
+
+    auto digit = [key](const T &x, int d) {
+        auto k = (Unsigned) ((Unsigned) key(x) ^ SIGN);
+        return (int) ((k >> (d * BITS)) & MASK);
+    };
+    radixSort(a, PASSES, 1 << BITS, digit, reverse);
+}
+
+template<typename T>
+template<typename DigitOf>
+void LSD<T>::radixSort(span<T> a, int passes, int R, DigitOf digit, bool reverse) {
+    int n = a.size();
+    if (n <= 1) return;
+
+    // compute frequency counts of every digit in one read of the input
+    vector<int> count(passes * R);
+    for (const T &x: a)
+        for (int d = 0; d < passes; d++)
+            count[d * R + digit(x, d)]++;
+
+    vector<T> aux(n);
+    span<T> from = a;
+    span<T> to = aux;
+    for (int d = 0; d < passes; d++) {
+        int *c = &count[d * R];
+
+        // skip the pass if every key has the same digit
+        if (c[digit(from[0], d)] == n) continue;
+
+        // compute the first index of every digit
+        int sum = 0;
+        if (!reverse) {
+            for (int r = 0; r < R; r++) {
+                int frequency = c[r];
+                c[r] = sum;
+                sum += frequency;
+            }
+        } else {
+            for (int r = R - 1; r >= 0; r--) {
+                int frequency = c[r];
+                c[r] = sum;
+                sum += frequency;
+            }
+        }
+
+        // distribute
+        for (T &x: from)
+            to[c[digit(x, d)]++] = std::move(x);
+        swap(from, to);
+    }
+
+    // copy back if the last pass left the items in aux
+    if (from.data() != a.data())
+        std::move(from.begin(), from.end(), a.begin());
+}
+
+template<typename T>
+template<typename KeyOf>
+bool LSD<T>::isSorted(span<T> a, KeyOf key, bool reverse) {
+    for (int i = 1; i < (int) a.size(); i++) {
+        if (!reverse && key(a[i]) < key(a[i - 1])) return false;
+        if (reverse && key(a[i]) > key(a[i - 1])) return false;
+    }
+    return true;
+}
+
+/**
+ * Deduct the type, <T>, of the LSD class based on constructor argument types
+ * and number of arguments
+ */
+template<typename T>
+LSD(span<T>) -> LSD<T>;
+
+template<typename T>
+LSD(vector<T>) -> LSD<T>;
+
+template<typename T, size_t SIZE>
+LSD(array<T, SIZE>) -> LSD<T>;
+
+template<typename T>
+LSD(span<T>, bool reverse) -> LSD<T>;
+
+template<typename T>
+LSD(vector<T>, bool reverse) -> LSD<T>;
+
+template<typename T, size_t SIZE>
+LSD(array<T, SIZE>, bool reverse) -> LSD<T>;
+
+template<typename T>
+LSD(span<T>, int w, bool reverse) -> LSD<T>;
+
+template<typename T>
+LSD(vector<T>, int w, bool reverse) -> LSD<T>;
+
+template<typename T, typename KeyOf> requires invocable<KeyOf &, const T &>
+LSD(span<T>, KeyOf key) -> LSD<T>;
+
+template<typename T, typename KeyOf> requires invocable<KeyOf &, const T &>
+LSD(vector<T>, KeyOf key) -> LSD<T>;
+
+template<typename T, typename KeyOf> requires invocable<KeyOf &, const T &>
+LSD(span<T>, KeyOf key, bool reverse) -> LSD<T>;
+
+template<typename T, typename KeyOf> requires invocable<KeyOf &, const T &>
+LSD(vector<T>, KeyOf key, bool reverse) -> LSD<T>;
+
+#endif //ALGORITHMS_LSD_HPP
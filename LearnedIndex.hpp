@@ -0,0 +1,274 @@
+#ifndef ALGORITHMS_LEARNEDINDEX_HPP
+#define ALGORITHMS_LEARNEDINDEX_HPP
+
+#include <span>                     // std::span
+#include <vector>                   // std::vector
+#include <concepts>                 // std::integral
+#include <algorithm>                // std::lower_bound, std::upper_bound, std::min, std::max, std::is_sorted
+#include <limits>                   // std::numeric_limits
+#include <cmath>                    // std::floor, std::sqrt
+#include <type_traits>              // std::make_unsigned_t
+#include <cstddef>                  // std::size_t
+#include <stdexcept>                // std::invalid_argument
+#include <cassert>                  // std::assert
+
+using namespace std;
+
+/**
+ *  The ways a {@code LearnedIndex} can predict the position of a key:
+ *  {@code PiecewiseLinear} fits a piecewise-linear model with a guaranteed
+ *  maximum error when it is built, and {@code Interpolation} keeps no model
+ *  and interpolates between the keys of the array at every lookup.
+ */
+enum class LearnedIndexMode {
+    PiecewiseLinear, Interpolation
+};
+
+/**
+ *  The {@code LearnedIndex} class is a static search index over a sorted
+ *  array of integer keys, which answers the index-of, rank and lower-bound
+ *  queries of binary search by predicting where a key is instead of bisecting
+ *  the whole array.
+ *
+ *  In the piecewise-linear mode the index is a list of segments in the style of
+ *  the PGM index of Ferragina and Vinciguerra. Each segment is a line through
+ *  the position of its first key, and covers the longest run of keys whose
+ *  rank the line predicts to within {@code epsilon}; the segments are found in
+ *  one pass by narrowing the range of slopes that still fit every key so far.
+ *  The rank of every integer between two keys is covered too, so keys that are
+ *  not present are predicted as well. A lookup finds the segment by binary
+ *  search over the first keys of the segments, which are few and stay in
+ *  cache, and then binary searches the 2 epsilon + 1 keys around the
+ *  prediction. On keys that are nearly uniform, a handful of segments cover
+ *  millions of keys.
+ *
+ *  In the interpolation mode, a lookup estimates the position of the key from
+ *  the keys at the ends of the range and their positions, probes the estimate,
+ *  and then probes a guard about the square root of the range away from it on
+ *  the side of the key, which narrows the range from both sides to the gap
+ *  between the two probes when the estimate is close. A step that does not
+ *  halve the range is followed by a bisection, so a lookup never takes more
+ *  than three times the probes of binary search, and about 2 log log n on
+ *  uniform keys.
+ *
+ *  The index refers to the sorted array, which must outlive it and not change.
+ *  Its own memory is that of the segments, three words each.
+ *  The constructor takes Θ(n) time. In the piecewise-linear mode a lookup takes
+ *  Θ(log(s) + log(epsilon)) time for s segments.
+ *
+ *  @author Benjamin Chan
+ *
+ *  @param <T> the integer type of a key
+ */
+template<integral T>
+class LearnedIndex {
+public:
+    /**
+     * Builds the index over the keys of a sorted array.
+     *
+     * @param  sorted the keys, which must be in ascending order
+     * @param  mode the way the index predicts the position of a key
+     * @param  epsilon the maximum error of the piecewise-linear model in positions
+     * @throws invalid_argument if {@code epsilon < 1}
+     */
+    explicit LearnedIndex(span<const T> sorted, LearnedIndexMode mode = LearnedIndexMode::PiecewiseLinear,
+                          int epsilon = 32) : a(sorted), mode(mode), epsilon(epsilon) {
+        if (epsilon < 1) throw invalid_argument("epsilon is less than one.");
+        assert(is_sorted(a.begin(), a.end()));
+        if (mode == LearnedIndexMode::PiecewiseLinear) fit();
+    }
+
+    /**
+     * Returns the number of keys in the index.
+     *
+     * @return the number of keys in the index
+     */
+    int size() const {
+        return (int) a.size();
+    }
+
+    /**
+     * Returns the number of segments of the piecewise-linear model.
+     *
+     * @return the number of segments, or 0 in the interpolation mode
+     */
+    int segmentCount() const {
+        return (int) segments.size();
+    }
+
+    /**
+     * Returns the number of bytes the index takes besides the sorted array.
+     *
+     * @return the number of bytes of the model
+     */
+    size_t bytes() const {
+        return sizeof(*this) + segments.capacity() * sizeof(Segment);
+    }
+
+    /**
+     * Returns the number of keys in the index that are strictly less than {@code key}.
+     *
+     * @param  key the key
+     * @return the number of keys in the index that are strictly less than {@code key}
+     */
+    int rank(T key) const {
+        if (a.empty() || key <= a.front()) return 0;
+        if (key > a.back()) return (int) a.size();
+        return mode == LearnedIndexMode::PiecewiseLinear ? modelRank(key) : interpolationRank(key);
+    }
+
+    /**
+     * Returns the index in the sorted array of the first key that is not less
+     * than {@code key}, which is the same as its rank.
+     *
+     * @param  key the key
+     * @return the index of the first key not less than {@code key}, or {@code size()} if there is none
+     */
+    int lowerBound(T key) const {
+        return rank(key);
+    }
+
+    /**
+     * Returns the index of the specified key in the sorted array; the first
+     * one, if the key is there more than once.
+     *
+     * @param  key the search key
+     * @return index of key in the sorted array if present; {@code -1} otherwise
+     */
+    int indexOf(T key) const {
+        int i = rank(key);
+        return i < (int) a.size() && a[i] == key ? i : -1;
+    }
+
+private:
+    /// a line through (key, rank) that predicts the rank of the keys up to the next segment
+    struct Segment {
+        T key;
+        int rank;
+        double slope;
+    };
+
+    span<const T> a;                // the sorted keys
+    LearnedIndexMode mode;          // the way the index predicts the position of a key
+    int epsilon;                    // the maximum error of the model
+    vector<Segment> segments;       // the segments, in order of their first keys
+
+    // the line of the current segment passes through its first point with a slope between lo and hi
+    void fit();
+
+    // the rank of a key between the first and the last key, from the model
+    int modelRank(T key) const;
+
+    // the rank of a key between the first and the last key, by interpolation
+    int interpolationRank(T key) const;
+
+    // the distance from x up to y as a double, subtracted in the integer domain first, so that it keeps
+    // the low bits of keys beyond 2^53 that converting each key to a double would round away
+    static double distance(T x, T y) {
+        using U = make_unsigned_t<T>;
+        return (double) (U) ((U) y - (U) x);
+    }
+};
+
+template<integral T>
+void LearnedIndex<T>::fit() {
+    int n = (int) a.size();
+    if (n == 0) return;
+
+    // the points are (x, rank of x) for every distinct key x, and for the integer after x if it is not a key,
+    // which has the rank of the next key; every integer query between them has a rank between theirs
+    Segment current{a[0], 0, 0};
+    double lo = 0, hi = numeric_limits<double>::infinity();
+    auto add = [&](T x, int rank) {
+        double dx = distance(current.key, x);
+        double low = (rank - epsilon - current.rank) / dx;
+        double high = (rank + epsilon - current.rank) / dx;
+        if (max(lo, low) <= min(hi, high)) {
+            lo = max(lo, low);
+            hi = min(hi, high);
+            return;
+        }
+        current.slope = hi == numeric_limits<double>::infinity() ? lo : (lo + hi) / 2;
+        segments.push_back(current);
+        current = {x, rank, 0};
+        lo = 0;
+        hi = numeric_limits<double>::infinity();
+    };
+    for (int i = 0; i < n;) {
+        int next = i + 1;
+        while (next < n && a[next] == a[i]) next++;
+        if (i > 0) add(a[i], i);
+        if (next < n && a[i] + 1 < a[next]) add(a[i] + 1, next);
+        i = next;
+    }
+    current.slope = hi == numeric_limits<double>::infinity() ? lo : (lo + hi) / 2;
+    segments.push_back(current);
+}
+
+template<integral T>
+int LearnedIndex<T>::modelRank(T key) const {
+    // the last segment whose first key is at most key
+    auto segment = upper_bound(segments.begin(), segments.end(), key,
+                               [](T x, const Segment &s) { return x < s.key; }) - 1;
+    double predicted = segment->rank + segment->slope * distance(segment->key, key);
+
+    // past the last point of its segment a key has the rank of the first key of the next segment
+    if (segment + 1 != segments.end()) predicted = min(predicted, (double) segment[1].rank);
+
+    // the rank is within epsilon of the prediction; one more on each side absorbs rounding
+    int n = (int) a.size();
+    long p = (long) floor(predicted);
+    int first = (int) min<long>(n, max<long>(0, p - epsilon - 1));
+    int last = (int) min<long>(n, max<long>(0, p + epsilon + 2));
+    return (int) (lower_bound(a.begin() + first, a.begin() + last, key) - a.begin());
+}
+
+template<integral T>
+int LearnedIndex<T>::interpolationRank(T key) const {
+    // a[lo] < key <= a[hi]
+    int lo = 0, hi = (int) a.size() - 1;
+    bool interpolate = true;
+    while (hi - lo > 1) {
+        int before = hi - lo;
+        if (interpolate) {
+            // on uniform keys the estimate is off by about the standard deviation of a binomial over the range,
+            // so a guard that far past it on the side of the key usually brackets the key between the two probes
+            double fraction = distance(a[lo], key) / distance(a[lo], a[hi]);
+            int mid = min(hi - 1, max(lo + 1, lo + (int) (fraction * before)));
+            int guard = max(1, (int) sqrt(before * fraction * (1 - fraction)));
+            if (a[mid] < key) {
+                lo = mid;
+                if (mid + guard < hi) {
+                    if (a[mid + guard] < key) lo = mid + guard;
+                    else hi = mid + guard;
+                }
+            } else {
+                hi = mid;
+                if (mid - guard > lo) {
+                    if (a[mid - guard] < key) lo = mid - guard;
+                    else hi = mid - guard;
+                }
+            }
+        } else {
+            int mid = lo + before / 2;
+            if (a[mid] < key) lo = mid;
+            else hi = mid;
+        }
+
+        // bisect after an estimate that left more than half the range
+        interpolate = !interpolate || hi - lo <= before / 2;
+    }
+    return hi;
+}
+
+/// Uses type deduction for the constructor
+template<typename T>
+LearnedIndex(vector<T>)->LearnedIndex<T>;
+
+template<typename T>
+LearnedIndex(vector<T>, LearnedIndexMode)->LearnedIndex<T>;
+
+template<typename T>
+LearnedIndex(vector<T>, LearnedIndexMode, int)->LearnedIndex<T>;
+
+#endif //ALGORITHMS_LEARNEDINDEX_HPP
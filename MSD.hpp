@@ -0,0 +1,150 @@
+#ifndef ALGORITHMS_MSD_HPP
+#define ALGORITHMS_MSD_HPP
+
+#include <span>                 // std::span
+#include <array>                // std::array
+#include <vector>               // std::vector
+#include <algorithm>            // std::min, std::max
+#include "Quick3string.hpp"     // includes CharString concept and the 3-way string quicksort
+#include <cassert>              // std::assert
+
+using namespace std;
+
+/**
+ *  The {@code MSD} class provides a public method for sorting a container of
+ *  strings, using MSD radix sort.
+ *
+ *  The strings are distributed by their first character with key-indexed
+ *  counting, and each group of strings with the same first character is then
+ *  sorted by its second character, and so on. Strings that end are placed
+ *  before (after, in reverse) every longer string with the same prefix and are
+ *  not examined again.
+ *
+ *  Distributing a small subarray costs more than it gains, so subarrays of at
+ *  most 64 strings are sorted by the 3-way radix quicksort of
+ *  {@code Quick3string}, which itself finishes subarrays of at most 15
+ *  strings by insertion sort. The d-th characters of a subarray are read only
+ *  once, into a cache, and the counts cover only the range of characters that
+ *  occur there, so keys over a small alphabet, such as lowercase words or
+ *  digits, clear and sum a few dozen counts instead of 256.
+ *
+ *  This implementation examines ~ n log_R n characters for random strings,
+ *  and uses Θ(n + w R) extra space, where w is the length of the longest
+ *  string and R the size of the alphabet.
+ *  This sorting algorithm is not stable.
+ *
+ *  @author Benjamin Chan
+ *
+ *  Adapted from Algorithms, 4th edition, {@authors Robert Sedgewick and Kevin Wayne}
+ *  and their booksite https://algs4.cs.princeton.edu/
+ *
+ *  The Java program from which this C++ code was adapted from is found at
+ *  https://algs4.cs.princeton.edu/51radix/MSD.java.html.
+ *
+ *  @param <T> the generic type of an item in this sorting algorithm
+ */
+template<typename T> requires CharString<T>
+class MSD {
+public:
+    /**
+     * Rearranges the container of strings in ascending order, or descending order.
+     *
+     * @param a, the container to be sorted
+     * @param a boolean specifying whether it should be reverse
+     */
+    explicit MSD<T>(span<T> a, bool reverse = false) {
+        int n = a.size();
+        if (n > CUTOFF) {
+            vector<T> aux(n);
+            vector<int> digits(n);
+            sort(a, aux, digits, 0, n - 1, 0, reverse);
+        } else {
+            Quick3string<T>::sort(a, 0, n - 1, 0, reverse);
+        }
+        assert(Quick3string<T>::isSorted(a, reverse));
+    };
+
+private:
+    using Strings = Quick3string<T>;
+
+    // cutoff to 3-way radix quicksort
+    static constexpr int CUTOFF = 64;
+
+    // sort from a[lo] to a[hi], starting at the dth character
+    static void sort(span<T> a, span<T> aux, span<int> digits, int lo, int hi, int d, bool reverse);
+};
+
+template<typename T>
+requires CharString<T>
+void MSD<T>::sort(span<T> a, span<T> aux, span<int> digits, int lo, int hi, int d, bool reverse) {
+    if (hi - lo + 1 <= CUTOFF) {
+        Strings::sort(a, lo, hi, d, reverse);
+        return;
+    }
+
+    // read the dth characters once, and find the range of characters that occur
+    int min = digits[lo] = Strings::charAt(a[lo], d, reverse);
+    int max = min;
+    for (int i = lo + 1; i <= hi; i++) {
+        int c = digits[i] = Strings::charAt(a[i], d, reverse);
+        if (c < min) min = c;
+        if (c > max) max = c;
+    }
+
+    // every string has the same dth character, so go on to the next one
+    int end = Strings::endDigit(reverse);
+    if (min == max) {
+        if (min != end) sort(a, aux, digits, lo, hi, d + 1, reverse);
+        return;
+    }
+
+    // compute frequency counts of the characters min..max
+    int R = max - min + 1;
+    vector<int> count(R + 1);
+    for (int i = lo; i <= hi; i++)
+        count[digits[i] - min + 1]++;
+
+    // transform counts to indices
+    for (int r = 0; r < R; r++)
+        count[r + 1] += count[r];
+
+    // distribute
+    for (int i = lo; i <= hi; i++)
+        aux[count[digits[i] - min]++] = std::move(a[i]);
+
+    // copy back
+    for (int i = lo; i <= hi; i++)
+        a[i] = std::move(aux[i - lo]);
+
+    // recursively sort for each character, except the strings that have ended
+    int start = lo;
+    for (int r = 0; r < R; r++) {
+        int next = lo + count[r];
+        if (r + min != end && next - start > 1) sort(a, aux, digits, start, next - 1, d + 1, reverse);
+        start = next;
+    }
+}
+
+/**
+ * Deduct the type, <T>, of the MSD class based on constructor argument types
+ * and number of arguments
+ */
+template<typename T> requires CharString<T>
+MSD(span<T>) -> MSD<T>;
+
+template<typename T> requires CharString<T>
+MSD(vector<T>) -> MSD<T>;
+
+template<typename T, size_t SIZE> requires CharString<T>
+MSD(array<T, SIZE>) -> MSD<T>;
+
+template<typename T> requires CharString<T>
+MSD(span<T>, bool reverse) -> MSD<T>;
+
+template<typename T> requires CharString<T>
+MSD(vector<T>, bool reverse) -> MSD<T>;
+
+template<typename T, size_t SIZE> requires CharString<T>
+MSD(array<T, SIZE>, bool reverse) -> MSD<T>;
+
+#endif //ALGORITHMS_MSD_HPP
@@ -4,7 +4,13 @@
 #include <span>                     // std::span
 #include <array>                    // std::array
 #include <vector>                   // std::vector
+#include <functional>               // std::less, std::greater
+#include <iterator>                 // std::make_move_iterator
+#include <algorithm>                // std::min
+#include <bit>                      // std::bit_width
 #include "Comparable.hpp"           // includes Comparable concept used as a constraint
+#include "DaryHeap.hpp"             // includes the d-ary heap swim and sink
+#include "PoolAllocator.hpp"        // includes CacheAlignedAllocator
 #include <cassert>                  // std::assert
 #include <boost/lexical_cast.hpp>   // boost::lexical_cast
 
@@ -17,7 +23,11 @@ using namespace std;
  *  testing if the priority queue is empty, and iterating through
  *  the keys.
  *
- *  This implementation uses a binary heap.
+ *  This implementation uses a binary heap, or a d-ary heap for an arity D
+ *  of 4 or 8. The D children of a node are adjacent and the array is aligned
+ *  to cache lines, so a 4-ary heap of 4-byte keys reads every level of a sink
+ *  from one cache line and needs half the levels of a binary heap; see
+ *  {@code DaryHeap.hpp}.
  *  The insert and delete-the-maximum operations take
  *  Θ(log(n)) amortized time, where n is the number
  *  of elements in the priority queue. This is an amortized bound
@@ -26,6 +36,10 @@ using namespace std;
  *  Θ(1) time in the worst case.
  *  Construction takes time proportional to the specified capacity or the
  *  number of items used to initialize the data structure.
+ *  Replacing the maximum key takes Θ(log(n)) time.
+ *  Inserting a batch of m keys takes Θ(m + log²(n)) time, and so does
+ *  merging a priority queue of m keys into this one; deleting the k largest
+ *  keys takes Θ(k log(n)) time, with about half the compares of k deletions.
  *
  *  @author Benjamin Chan
  *
@@ -36,8 +50,9 @@ using namespace std;
  *  https://algs4.cs.princeton.edu/24pq/MaxPQ.java.html.
  *
  *  @param <T> the generic type of key on this priority queue
+ *  @param <D> the number of children of every node: 2, 4 or 8
  */
-template<typename T> requires Comparable<T>
+template<typename T, int D = 2> requires Comparable<T> && (D == 2 || D == 4 || D == 8)
 class MaxPQ {
 public:
     /**
@@ -45,6 +60,7 @@ public:
      */
     MaxPQ() {
         this->n = 0;
+        pq = Heap(D - 1);
     }
 
     /**
@@ -55,10 +71,10 @@ public:
      */
     explicit MaxPQ(vector<T> keys) {
         n = keys.size();
-        pq = vector<T>(n + 1);
+        pq = Heap(n + D - 1);
         for (int i = 0; i < n; i++)
-            pq[i + 1] = keys[i];
-        for (int k = n / 2; k >= 1; k--)
+            heap()[i + 1] = keys[i];
+        for (int k = n > 1 ? heapParent<D>(n) : 0; k >= 1; k--)
             sink(k);
     }
 
@@ -90,11 +106,12 @@ public:
     T max() {
         try {
             if (isEmpty()) throw NoSuchElementException();
-            return pq[1];
+            return heap()[1];
         }
         catch (NoSuchElementException &e) {
             std::cout << "NoSuchElementException encountered: ";
             std::cout << e.what() << std::endl;
+            return T();
         }
     }
 
@@ -106,7 +123,7 @@ public:
     void insert(T x) {
         // add x, and percolate it up to maintain heap invariant
         pq.push_back(x);
-        swim(n);
+        swim(++n);
     }
 
     /**
@@ -119,18 +136,77 @@ public:
         try {
             if (isEmpty()) throw NoSuchElementException();
 
-            T max = pq[1];
-            exch(1, n--);
-            sink(1);
-            pq.erase(pq.begin() + n + 1); // to avoid loitering and help with garbage collection
+            T max = std::move(heap()[1]);
+            if (--n > 0) heap()[1] = std::move(heap()[n + 1]);
+            pq.pop_back();
+            if (n > 0) sink(1);
             return max;
         }
         catch (NoSuchElementException &e) {
             std::cout << "NoSuchElementException encountered: ";
             std::cout << e.what() << std::endl;
+            return T();
         }
     }
 
+    /**
+     * Replaces a largest key on this priority queue with a new key, and returns
+     * the key that was replaced. This takes one sink, where a delete-the-maximum
+     * followed by an insert takes a sink and a swim.
+     *
+     * @param  x the new key to add to this priority queue
+     * @return the largest key that was replaced
+     * @throws NoSuchElementException if this priority queue is empty
+     */
+    T replaceMax(T x) {
+        if (isEmpty()) throw NoSuchElementException();
+        T old = std::move(heap()[1]);
+        heap()[1] = std::move(x);
+        sink(1);
+        return old;
+    }
+
+    /**
+     * Adds the keys to this priority queue. A batch that is large compared
+     * to the priority queue is heap-ordered in one bottom-up pass over the
+     * ancestors of the new keys; a small one by swimming every key.
+     *
+     * @param  keys the new keys to add to this priority queue
+     */
+    void insertBatch(span<const T> keys) {
+        pq.insert(pq.end(), keys.begin(), keys.end());
+        heapOrderAppended(keys.size());
+    }
+
+    /**
+     * Removes the k largest keys on this priority queue, or all of them if there
+     * are fewer, and appends them to {@code out} in descending order.
+     *
+     * @param  k the number of keys to remove
+     * @param  out the container to append the keys to
+     */
+    void popK(int k, vector<T> &out) {
+        k = std::min(k, n);
+        if (k <= 0) return;
+        out.reserve(out.size() + k);
+        heapPopK<D>(heap(), n, k, out, std::greater<T>());
+        n -= k;
+        pq.erase(pq.end() - k, pq.end());
+    }
+
+    /**
+     * Moves all keys of another priority queue into this one, leaving the other one empty.
+     *
+     * @param  other the priority queue to absorb
+     */
+    void merge(MaxPQ<T, D> &&other) {
+        int m = other.n;
+        pq.insert(pq.end(), make_move_iterator(other.pq.end() - m), make_move_iterator(other.pq.end()));
+        other.pq = Heap(D - 1);
+        other.n = 0;
+        heapOrderAppended(m);
+    }
+
     /**
       * Returns a string representation of this priority queue.
       *
@@ -138,59 +214,58 @@ public:
       */
     [[nodiscard]] std::string toString() const;
 
-private:
-    vector<T> pq;               // store items at indices 1 to n
-    int n{};                    // number of items on priority queue
-
     /**
      * @def the NoSuchElementException if there are no items in the priority queue after
-     * using the max(), methods
+     * using the max(), delMax() or replaceMax() methods
      */
     struct NoSuchElementException : public std::exception {
-        const char *what() {
+        [[nodiscard]] const char *what() const noexcept override {
             return "Priority Queue Underflow";
         }
     };
 
+private:
+    using Heap = vector<T, CacheAlignedAllocator<T>>;
+
+    Heap pq;                    // store items at indices D - 1 to n + D - 2
+    int n{};                    // number of items on priority queue
+
     /***************************************************************************
      * Helper functions to restore the heap invariant.
      ***************************************************************************/
 
+    // node k of the heap is heap()[k], for k from 1 to n
+    T *heap() {
+        return pq.data() + D - 2;
+    }
+
     void swim(int k) {
-        while (k > 1 && pq[k / 2] < k) {
-            exch(k, k / 2);
-            k = k / 2;
-        }
+        heapSwim<D>(heap(), k, std::greater<T>());
     }
 
     void sink(int k) {
-        while (2 * k <= n) {
-            int j = 2 * k;
-            if (j < n && pq[j] < pq[j + 1]) j++;
-            if (pq[k] >= pq[j]) break;
-            exch(k, j);
-            k = j;
-        }
+        heapSink<D>(heap(), k, n, std::greater<T>());
     }
 
-
-    /***************************************************************************
-     * Helper functions for compares and swaps.
-     ***************************************************************************/
-
-    void exch(int i, int j) {
-        T swap = pq[i];
-        pq[i] = pq[j];
-        pq[j] = swap;
+    // restore the heap order after m keys have been appended to pq; the bottom-up pass sinks every ancestor of
+    // the batch up to the root, which pays off only for a batch large compared to the heap, m lg n >= n,
+    // while a key of a smaller batch swims up a few levels on average
+    void heapOrderAppended(int m) {
+        if ((long) m * bit_width((unsigned) (n + m)) >= n + m) {
+            int lo = n + 1;
+            n += m;
+            heapifyRange<D>(heap(), lo, n, n, std::greater<T>());
+        } else {
+            for (int i = 0; i < m; i++) swim(++n);
+        }
     }
-
 };
 
-template<typename T>
-requires Comparable<T>
-std::string MaxPQ<T>::toString() const {
+template<typename T, int D>
+requires Comparable<T> && (D == 2 || D == 4 || D == 8)
+std::string MaxPQ<T, D>::toString() const {
     std::stringstream ss;
-    MaxPQ<T> copy{this->pq};
+    MaxPQ<T, D> copy{vector<T>(this->pq.begin() + D - 1, this->pq.begin() + this->n + D - 1)};
     while (!copy.isEmpty()) {
         ss << boost::lexical_cast<std::string>(copy.delMax()) << " ";
     }
@@ -199,8 +274,8 @@ std::string MaxPQ<T>::toString() const {
 }
 
 /// Overloads the "<<" operator for a bag
-template<typename T>
-std::ostream &operator<<(std::ostream &os, const MaxPQ<T> &maxPQ) {
+template<typename T, int D>
+std::ostream &operator<<(std::ostream &os, const MaxPQ<T, D> &maxPQ) {
     return os << maxPQ.toString();
 }
 
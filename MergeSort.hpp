@@ -2,7 +2,12 @@
 #define ALGORITHMS_MERGESORT_HPP
 
 #include <span>                 // std::span, std::array, std::vector
+#include <algorithm>            // std::min, std::max
 #include "Comparable.hpp"       // includes Comparable concept used as a constraint
+#include <functional>           // std::less, std::greater
+#include <cassert>              // std::assert
+#include "ThreadPool.hpp"       // ThreadPool, TaskGroup
+#include "BufferedMerge.hpp"    // includes bufferedMerge and binaryInsertionSort
 
 using namespace std;
 
@@ -17,6 +22,20 @@ using namespace std;
  *  ~ ½ * n * lg(n) and
  *  ~ 1 * n * lg(n) compares.
  *
+ *  The parallel mode forks the two recursive calls onto a work-stealing
+ *  {@code ThreadPool} until a subarray is shorter than the cutoff, below which
+ *  it sorts sequentially. Large merges are split into independent pieces at
+ *  co-ranked positions of the two input runs, so the top levels of the
+ *  recursion tree are parallel as well. The output is identical to that of
+ *  the sequential sort: both modes are stable.
+ *
+ *  The memory-bounded mode allocates nothing. It merges through a scratch
+ *  buffer of any length from 0 to n that the caller supplies, splitting the
+ *  merges that do not fit by rotation (see {@code bufferedMerge}), and sorts
+ *  subarrays of at most 16 items by binary insertion sort. It is stable, and
+ *  takes Θ(n log² n) time with an empty buffer and Θ(n log n) time with a
+ *  buffer of n / 2 items.
+ *
  *  @author Benjamin Chan
  *
  *  Adapted from Algorithms, 4th edition, {@authors Robert Sedgewick and Kevin Wayne}
@@ -41,6 +60,39 @@ public:
         sort(a, aux, 0, a.size() - 1, reverse);
         assert(isSorted(a, reverse));
     };
+
+    /**
+     * Rearranges the container in ascending order, using the natural order, or descending order,
+     * sorting and merging subarrays in parallel on the given thread pool.
+     *
+     * @param a, the container to be sorted
+     * @param pool, the thread pool that runs the forked subproblems
+     * @param a boolean specifying whether it should be reverse
+     * @param cutoff, the subarray length below which sorting and merging are sequential
+     */
+    explicit MergeSort<T>(span<T> a, ThreadPool &pool, bool reverse = false, int cutoff = PARALLEL_CUTOFF) {
+        int length = a.size();
+        vector<T> aux(length);
+        parallelSort(pool, a, aux, 0, length - 1, reverse, max(cutoff, 2));
+        assert(isSorted(a, reverse));
+    };
+
+    /**
+     * Rearranges the container in ascending order, using the natural order, or descending order,
+     * without allocating memory beyond the scratch buffer.
+     *
+     * @param a, the container to be sorted
+     * @param buffer, the scratch space of any length that the merges may overwrite
+     * @param a boolean specifying whether it should be reverse
+     */
+    explicit MergeSort<T>(span<T> a, span<T> buffer, bool reverse = false) {
+        if (!reverse) boundedSort(a, buffer, 0, (int) a.size() - 1, std::less<T>());
+        else boundedSort(a, buffer, 0, (int) a.size() - 1, std::greater<T>());
+        assert(isSorted(a, reverse));
+    };
+
+    /// the default subarray length below which the parallel mode runs sequentially
+    static constexpr int PARALLEL_CUTOFF = 1 << 13;
 private:
     // private helper sort
     void sort(span<T> a, span<T> aux, int lo, int hi, bool reverse = false);
@@ -48,6 +100,22 @@ private:
     // merge the two sub-arrays
     void merge(span<T> a, span<T> aux, int lo, int mid, int hi, bool reverse = false);
 
+    // sort a[lo .. hi], forking the halves onto the pool
+    void parallelSort(ThreadPool &pool, span<T> a, span<T> aux, int lo, int hi, bool reverse, int cutoff);
+
+    // merge the two sub-arrays, splitting the merge into pieces that run on the pool
+    void parallelMerge(ThreadPool &pool, span<T> a, span<T> aux, int lo, int mid, int hi, bool reverse, int cutoff);
+
+    // sort a[lo .. hi], merging through the buffer only
+    template<typename Less>
+    static void boundedSort(span<T> a, span<T> buffer, int lo, int hi, Less less);
+
+    // merge aux[i .. mid] and aux[j .. hi] into a[k ..] until a[end - 1] is written
+    static void mergeRun(span<T> a, span<T> aux, int i, int mid, int j, int hi, int k, int end, bool reverse);
+
+    // number of items of aux[lo .. mid] among the first k items of the merge with aux[mid+1 .. hi]
+    static int coRank(span<T> aux, int lo, int mid, int hi, int k, bool reverse);
+
     // check if entire container is sorted -- useful for debugging
     bool isSorted(span<T> a, int lo, int hi, bool reverse = false);
 
@@ -109,6 +177,121 @@ void MergeSort<T>::merge(span<T> a, span<T> aux, int lo, int mid, int hi, bool r
     assert(isSorted(a, lo, hi, reverse));
 }
 
+template<typename T>
+requires Comparable<T>
+void MergeSort<T>::parallelSort(ThreadPool &pool, span<T> a, span<T> aux, int lo, int hi, bool reverse,
+                                int cutoff) {
+    if (hi - lo < cutoff) {
+        sort(a, aux, lo, hi, reverse);
+        return;
+    }
+    int mid = lo + (hi - lo) / 2;
+    {
+        TaskGroup group(pool);
+        group.run([&] { parallelSort(pool, a, aux, lo, mid, reverse, cutoff); });
+        parallelSort(pool, a, aux, mid + 1, hi, reverse, cutoff);
+        group.wait();
+    }
+    parallelMerge(pool, a, aux, lo, mid, hi, reverse, cutoff);
+}
+
+template<typename T>
+requires Comparable<T>
+void MergeSort<T>::parallelMerge(ThreadPool &pool, span<T> a, span<T> aux, int lo, int mid, int hi, bool reverse,
+                                 int cutoff) {
+    // precondition: a[lo .. mid] and a[mid+1 .. hi] are sorted subarrays
+    assert(isSorted(a, lo, mid, reverse));
+    assert(isSorted(a, mid + 1, hi, reverse));
+
+    int length = hi - lo + 1;
+    int pieces = (length + cutoff - 1) / cutoff;
+    int step = (length + pieces - 1) / pieces;
+
+    // copy to aux[]
+    {
+        TaskGroup group(pool);
+        for (int start = lo + step; start <= hi; start += step)
+            group.run([=] { copy(a.begin() + start, a.begin() + min(start + step, hi + 1), aux.begin() + start); });
+        copy(a.begin() + lo, a.begin() + min(lo + step, hi + 1), aux.begin() + lo);
+        group.wait();
+    }
+
+    // merge back to a[], each piece writing the output positions [start, end)
+    auto mergePiece = [=](int start) {
+        int end = min(start + step, hi + 1);
+        int i = lo + coRank(aux, lo, mid, hi, start - lo, reverse);
+        int iEnd = lo + coRank(aux, lo, mid, hi, end - lo, reverse);
+        int j = mid + 1 + (start - lo) - (i - lo);
+        int jEnd = mid + 1 + (end - lo) - (iEnd - lo);
+        mergeRun(a, aux, i, iEnd - 1, j, jEnd - 1, start, end, reverse);
+    };
+    {
+        TaskGroup group(pool);
+        for (int start = lo + step; start <= hi; start += step)
+            group.run([=] { mergePiece(start); });
+        mergePiece(lo);
+        group.wait();
+    }
+
+    // postcondition: a[lo .. hi] is sorted
+    assert(isSorted(a, lo, hi, reverse));
+}
+
+template<typename T>
+requires Comparable<T>
+template<typename Less>
+void MergeSort<T>::boundedSort(span<T> a, span<T> buffer, int lo, int hi, Less less) {
+    if (hi - lo < BUFFERED_MERGE_CUTOFF) {
+        binaryInsertionSort(a, lo, hi, less);
+        return;
+    }
+    int mid = lo + (hi - lo) / 2;
+    boundedSort(a, buffer, lo, mid, less);
+    boundedSort(a, buffer, mid + 1, hi, less);
+    bufferedMerge(a, lo, mid, hi, buffer, less);
+}
+
+template<typename T>
+requires Comparable<T>
+void MergeSort<T>::mergeRun(span<T> a, span<T> aux, int i, int mid, int j, int hi, int k, int end, bool reverse) {
+    // same tie-breaking as merge(): an item of the left run goes first unless strictly out of order
+    if (!reverse) {
+        for (; k < end; k++) {
+            if (i > mid) a[k] = aux[j++];
+            else if (j > hi) a[k] = aux[i++];
+            else if (aux[j] < aux[i]) a[k] = aux[j++];
+            else a[k] = aux[i++];
+        }
+    } else {
+        for (; k < end; k++) {
+            if (i > mid) a[k] = aux[j++];
+            else if (j > hi) a[k] = aux[i++];
+            else if (aux[j] > aux[i]) a[k] = aux[j++];
+            else a[k] = aux[i++];
+        }
+    }
+}
+
+template<typename T>
+requires Comparable<T>
+int MergeSort<T>::coRank(span<T> aux, int lo, int mid, int hi, int k, bool reverse) {
+    int leftLength = mid - lo + 1;
+    int rightLength = hi - mid;
+
+    // binary search for the smallest i such that the left item aux[lo + i] does not
+    // precede the right item aux[mid + 1 + k - i - 1] in the stable merge
+    int first = max(0, k - rightLength), last = min(k, leftLength);
+    while (first < last) {
+        int i = first + (last - first) / 2;
+        const T &left = aux[lo + i];
+        const T &right = aux[mid + k - i];
+        bool leftFirst = reverse ? !(right > left) : !(right < left);
+        if (leftFirst) first = i + 1;
+        else last = i;
+    }
+    return first;
+}
+
 template<typename T>
 requires Comparable<T>
 bool MergeSort<T>::isSorted(span<T> a, bool reverse) {
@@ -158,4 +341,46 @@ MergeSort(array<T, SIZE>, bool reverse) -> MergeSort<T>;
 template<typename T> requires Comparable<T>
 MergeSort(T a[], bool reverse) -> MergeSort<T>;
 
+template<typename T> requires Comparable<T>
+MergeSort(span<T>, ThreadPool &) -> MergeSort<T>;
+
+template<typename T> requires Comparable<T>
+MergeSort(vector<T>, ThreadPool &) -> MergeSort<T>;
+
+template<typename T, size_t SIZE> requires Comparable<T>
+MergeSort(array<T, SIZE>, ThreadPool &) -> MergeSort<T>;
+
+template<typename T> requires Comparable<T>
+MergeSort(span<T>, ThreadPool &, bool reverse) -> MergeSort<T>;
+
+template<typename T> requires Comparable<T>
+MergeSort(vector<T>, ThreadPool &, bool reverse) -> MergeSort<T>;
+
+template<typename T, size_t SIZE> requires Comparable<T>
+MergeSort(array<T, SIZE>, ThreadPool &, bool reverse) -> MergeSort<T>;
+
+template<typename T> requires Comparable<T>
+MergeSort(span<T>, ThreadPool &, bool reverse, int cutoff) -> MergeSort<T>;
+
+template<typename T> requires Comparable<T>
+MergeSort(vector<T>, ThreadPool &, bool reverse, int cutoff) -> MergeSort<T>;
+
+template<typename T> requires Comparable<T>
+MergeSort(span<T>, span<T> buffer) -> MergeSort<T>;
+
+template<typename T> requires Comparable<T>
+MergeSort(vector<T>, span<T> buffer) -> MergeSort<T>;
+
+template<typename T> requires Comparable<T>
+MergeSort(vector<T>, vector<T> buffer) -> MergeSort<T>;
+
+template<typename T> requires Comparable<T>
+MergeSort(span<T>, span<T> buffer, bool reverse) -> MergeSort<T>;
+
+template<typename T> requires Comparable<T>
+MergeSort(vector<T>, span<T> buffer, bool reverse) -> MergeSort<T>;
+
+template<typename T> requires Comparable<T>
+MergeSort(vector<T>, vector<T> buffer, bool reverse) -> MergeSort<T>;
+
 #endif //ALGORITHMS_MERGESORT_HPP
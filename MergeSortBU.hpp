@@ -3,10 +3,22 @@
 
 #include <span>                 // std::span, std::array, std::vector
 #include "Comparable.hpp"       // includes Comparable concept used as a constraint
-#include <algorithm>            // std::min
+#include <algorithm>            // std::min, std::reverse, std::move, std::move_backward
+#include <functional>           // std::less, std::greater
+#include <vector>               // std::vector
+#include <cassert>              // std::assert
+#include "BufferedMerge.hpp"    // includes bufferedMerge and binaryInsertionSort
 
 using namespace std;
 
+/// the ways {@code MergeSortBU} chooses the subarrays it merges
+enum class MergeSortBUMode {
+    // merge subarrays of widths 1, 2, 4, ...
+    PowerOfTwo,
+    // merge the runs already present in the input, as TimSort does
+    NaturalRuns
+};
+
 /**
  *  The {@code MergeSortBU} class uses merge-sort (bottom-up) to sort
  *  a container through invoking its
@@ -21,6 +33,25 @@ using namespace std;
  *  This sorting algorithm is stable.
  *  It uses Θ(n) extra memory (not including the input array).
  *
+ *  In {@code MergeSortBUMode::NaturalRuns} the sort adapts to the order already
+ *  in the input, as TimSort does. It finds the ascending and strictly
+ *  descending runs of the input, reverses the descending ones in place, and
+ *  extends runs shorter than a minimum length of 16 to 32 items by binary
+ *  insertion sort. The runs are pushed on a stack that is kept so that each
+ *  run is longer than the next two together, which keeps the merges balanced.
+ *  A merge first skips the items of either run that are already in place, then
+ *  copies only the smaller of the two runs into a temporary buffer, and
+ *  switches to galloping (exponential search) while one run keeps winning.
+ *  Sorted or reverse sorted input takes n - 1 compares and allocates nothing,
+ *  and the sort takes Θ(n log n) time in the worst case.
+ *
+ *  The memory-bounded mode allocates nothing. It sorts blocks of 16 items by
+ *  binary insertion sort and then merges them bottom-up through a scratch
+ *  buffer of any length from 0 to n that the caller supplies, splitting the
+ *  merges that do not fit by rotation (see {@code bufferedMerge}). It is
+ *  stable, and takes Θ(n log² n) time with an empty buffer and Θ(n log n)
+ *  time with a buffer of n / 2 items.
+ *
  *  @author Benjamin Chan
  *
  *  Adapted from Algorithms, 4th edition, {@authors Robert Sedgewick and Kevin Wayne}
@@ -41,18 +72,104 @@ public:
      * @param a boolean specifying whether it should be reverse
      */
     explicit MergeSortBU<T>(span<T> a, bool reverse = false) {
-        int n = a.size();
-        vector<T> aux(n);
-        for (int len = 1; len < n; len *= 2) {
-            for (int lo = 0; lo < n - len; lo += len + len) {
-                int mid = lo + len - 1;
-                int hi = min(lo + len + len - 1, n - 1);
-                merge(a, aux, lo, mid, hi, reverse);
-            }
-        }
+        powerOfTwoSort(a, reverse);
+        assert(isSorted(a, reverse));
+    };
+
+    /**
+     * Rearranges the container in ascending order, or descending order, merging
+     * either subarrays of power-of-two widths or the natural runs of the input.
+     *
+     * @param a, the container to be sorted
+     * @param mode, how to choose the subarrays to merge
+     * @param a boolean specifying whether it should be reverse
+     */
+    explicit MergeSortBU<T>(span<T> a, MergeSortBUMode mode, bool reverse = false) {
+        if (mode == MergeSortBUMode::PowerOfTwo) powerOfTwoSort(a, reverse);
+        else if (!reverse) naturalSort(a, std::less<T>());
+        else naturalSort(a, std::greater<T>());
+        assert(isSorted(a, reverse));
+    };
+
+    /**
+     * Rearranges the container in ascending order, or descending order, without
+     * allocating memory beyond the scratch buffer.
+     *
+     * @param a, the container to be sorted
+     * @param buffer, the scratch space of any length that the merges may overwrite
+     * @param a boolean specifying whether it should be reverse
+     */
+    explicit MergeSortBU<T>(span<T> a, span<T> buffer, bool reverse = false) {
+        if (!reverse) boundedSort(a, buffer, std::less<T>());
+        else boundedSort(a, buffer, std::greater<T>());
         assert(isSorted(a, reverse));
     };
+
 private:
+    // arrays shorter than this are sorted by binary insertion sort alone
+    static constexpr int MIN_MERGE = 32;
+
+    // the number of consecutive wins by one run after which a merge gallops
+    static constexpr int MIN_GALLOP = 7;
+
+    // the state of a natural merge sort: the stack of pending runs and the temporary buffer
+    template<typename Less>
+    struct Runs {
+        span<T> a;
+        Less less;
+        vector<T> tmp{};
+        int minGallop = MIN_GALLOP;
+        // runs i start at base[i] and are length[i] long; 85 runs are enough for any int length
+        int base[85]{};
+        int length[85]{};
+        int stackSize = 0;
+    };
+
+    // merge subarrays of widths 1, 2, 4, ...
+    void powerOfTwoSort(span<T> a, bool reverse);
+
+    // merge blocks of widths 16, 32, 64, ... through the buffer only
+    template<typename Less>
+    static void boundedSort(span<T> a, span<T> buffer, Less less);
+
+    // merge the natural runs of a, extended to a minimum length
+    template<typename Less>
+    static void naturalSort(span<T> a, Less less);
+
+    // the length of the run starting at a[lo], which is made ascending if it was strictly descending
+    template<typename Less>
+    static int countRunAndMakeAscending(span<T> a, int lo, int hi, Less less);
+
+    // sort a[lo..hi) by binary insertion sort, given that a[lo..start) is already sorted
+    template<typename Less>
+    static void binarySort(span<T> a, int lo, int hi, int start, Less less);
+
+    // the minimum length of a run for an array of length n
+    static int minRunLength(int n);
+
+    // merge runs until the stack invariants hold again
+    template<typename Less>
+    static void mergeCollapse(Runs<Less> &runs);
+
+    // merge the runs at stack positions i and i + 1
+    template<typename Less>
+    static void mergeAt(Runs<Less> &runs, int i);
+
+    // merge the adjacent runs a[base1..base1+len1) and a[base2..base2+len2), where len1 <= len2
+    template<typename Less>
+    static void mergeLo(Runs<Less> &runs, int base1, int len1, int base2, int len2);
+
+    // merge the adjacent runs a[base1..base1+len1) and a[base2..base2+len2), where len1 >= len2
+    template<typename Less>
+    static void mergeHi(Runs<Less> &runs, int base1, int len1, int base2, int len2);
+
+    // the index in the sorted run[base..base+len) before the leftmost item equal to key, searching from hint
+    template<typename Less>
+    static int gallopLeft(const T &key, span<T> run, int base, int len, int hint, Less less);
+
+    // the index in the sorted run[base..base+len) after the rightmost item equal to key, searching from hint
+    template<typename Less>
+    static int gallopRight(const T &key, span<T> run, int base, int len, int hint, Less less);
 
     // merge the two sub-arrays
     void merge(span<T> a, span<T> aux, int lo, int mid, int hi, bool reverse = false);
@@ -99,6 +216,418 @@ void MergeSortBU<T>::merge(span<T> a, span<T> aux, int lo, int mid, int hi, bool
     }
 }
 
+template<typename T>
+requires Comparable<T>
+void MergeSortBU<T>::powerOfTwoSort(span<T> a, bool reverse) {
+    int n = a.size();
+    vector<T> aux(n);
+    for (int len = 1; len < n; len *= 2) {
+        for (int lo = 0; lo < n - len; lo += len + len) {
+            int mid = lo + len - 1;
+            int hi = min(lo + len + len - 1, n - 1);
+            merge(a, aux, lo, mid, hi, reverse);
+        }
+    }
+}
+
+template<typename T>
+requires Comparable<T>
+template<typename Less>
+void MergeSortBU<T>::boundedSort(span<T> a, span<T> buffer, Less less) {
+    int n = a.size();
+    for (int lo = 0; lo < n; lo += BUFFERED_MERGE_CUTOFF)
+        binaryInsertionSort(a, lo, min(lo + BUFFERED_MERGE_CUTOFF, n) - 1, less);
+    for (int len = BUFFERED_MERGE_CUTOFF; len < n; len *= 2) {
+        for (int lo = 0; lo < n - len; lo += len + len) {
+            int mid = lo + len - 1;
+            int hi = min(lo + len + len - 1, n - 1);
+            bufferedMerge(a, lo, mid, hi, buffer, less);
+        }
+    }
+}
+
+template<typename T>
+requires Comparable<T>
+template<typename Less>
+void MergeSortBU<T>::naturalSort(span<T> a, Less less) {
+    int n = a.size();
+    if (n < 2) return;
+
+    // small arrays are sorted without merging
+    if (n < MIN_MERGE) {
+        int runLength = countRunAndMakeAscending(a, 0, n, less);
+        binarySort(a, 0, n, runLength, less);
+        return;
+    }
+
+    Runs<Less> runs{a, less};
+    int minRun = minRunLength(n);
+    for (int lo = 0; lo < n;) {
+        int runLength = countRunAndMakeAscending(a, lo, n, less);
+
+        // extend a short run to min(minRun, n - lo) items
+        if (runLength < minRun) {
+            int force = min(minRun, n - lo);
+            binarySort(a, lo, lo + force, lo + runLength, less);
+            runLength = force;
+        }
+
+        runs.base[runs.stackSize] = lo;
+        runs.length[runs.stackSize] = runLength;
+        runs.stackSize++;
+        mergeCollapse(runs);
+        lo += runLength;
+    }
+
+    // merge the remaining runs, the shorter neighbour first
+    while (runs.stackSize > 1) {
+        int i = runs.stackSize - 2;
+        if (i > 0 && runs.length[i - 1] < runs.length[i + 1]) i--;
+        mergeAt(runs, i);
+    }
+}
+
+template<typename T>
+requires Comparable<T>
+template<typename Less>
+int MergeSortBU<T>::countRunAndMakeAscending(span<T> a, int lo, int hi, Less less) {
+    int runHi = lo + 1;
+    if (runHi == hi) return 1;
+    if (less(a[runHi++], a[lo])) {
+        // strictly descending, so that reversing it keeps the sort stable
+        while (runHi < hi && less(a[runHi], a[runHi - 1])) runHi++;
+        reverse(a.begin() + lo, a.begin() + runHi);
+    } else {
+        while (runHi < hi && !less(a[runHi], a[runHi - 1])) runHi++;
+    }
+    return runHi - lo;
+}
+
+template<typename T>
+requires Comparable<T>
+template<typename Less>
+void MergeSortBU<T>::binarySort(span<T> a, int lo, int hi, int start, Less less) {
+    if (start == lo) start++;
+    for (; start < hi; start++) {
+        T pivot = std::move(a[start]);
+
+        // find the first item greater than the pivot, so equal items keep their order
+        int left = lo, right = start;
+        while (left < right) {
+            int mid = left + (right - left) / 2;
+            if (less(pivot, a[mid])) right = mid;
+            else left = mid + 1;
+        }
+        move_backward(a.begin() + left, a.begin() + start, a.begin() + start + 1);
+        a[left] = std::move(pivot);
+    }
+}
+
+template<typename T>
+requires Comparable<T>
+int MergeSortBU<T>::minRunLength(int n) {
+    // n itself if it is small; otherwise a length in [16, 32] that divides n into a power of two
+    // or slightly fewer runs
+    int r = 0;
+    while (n >= MIN_MERGE) {
+        r |= n & 1;
+        n >>= 1;
+    }
+    return n + r;
+}
+
+template<typename T>
+requires Comparable<T>
+template<typename Less>
+void MergeSortBU<T>::mergeCollapse(Runs<Less> &runs) {
+    // keep length[i - 2] > length[i - 1] + length[i] and length[i - 1] > length[i] for the top runs,
+    // checking four runs deep as in the corrected TimSort of de Gouw et al.
+    int *length = runs.length;
+    while (runs.stackSize > 1) {
+        int i = runs.stackSize - 2;
+        if ((i > 0 && length[i - 1] <= length[i] + length[i + 1]) ||
+            (i > 1 && length[i - 2] <= length[i] + length[i - 1])) {
+            if (length[i - 1] < length[i + 1]) i--;
+        } else if (length[i] > length[i + 1]) {
+            break;
+        }
+        mergeAt(runs, i);
+    }
+}
+
+template<typename T>
+requires Comparable<T>
+template<typename Less>
+void MergeSortBU<T>::mergeAt(Runs<Less> &runs, int i) {
+    span<T> a = runs.a;
+    int base1 = runs.base[i], len1 = runs.length[i];
+    int base2 = runs.base[i + 1], len2 = runs.length[i + 1];
+    runs.length[i] = len1 + len2;
+    if (i == runs.stackSize - 3) {
+        runs.base[i + 1] = runs.base[i + 2];
+        runs.length[i + 1] = runs.length[i + 2];
+    }
+    runs.stackSize--;
+
+    // the items of run 1 that are not greater than the first item of run 2 are already in place
+    int k = gallopRight(a[base2], a, base1, len1, 0, runs.less);
+    base1 += k;
+    len1 -= k;
+    if (len1 == 0) return;
+
+    // and so are the items of run 2 that are not less than the last item of run 1
+    len2 = gallopLeft(a[base1 + len1 - 1], a, base2, len2, len2 - 1, runs.less);
+    if (len2 == 0) return;
+
+    if (len1 <= len2) mergeLo(runs, base1, len1, base2, len2);
+    else mergeHi(runs, base1, len1, base2, len2);
+}
+
+template<typename T>
+requires Comparable<T>
+template<typename Less>
+void MergeSortBU<T>::mergeLo(Runs<Less> &runs, int base1, int len1, int base2, int len2) {
+    span<T> a = runs.a;
+    Less less = runs.less;
+
+    // copy the first run, which is the smaller one, into tmp
+    if ((int) runs.tmp.size() < len1) runs.tmp.resize(max(len1, min((int) a.size() / 2, 2 * len1)));
+    span<T> tmp = runs.tmp;
+    std::move(a.begin() + base1, a.begin() + base1 + len1, tmp.begin());
+
+    int cursor1 = 0;        // index into tmp
+    int cursor2 = base2;    // index into a
+    int dest = base1;       // index into a
+    a[dest++] = std::move(a[cursor2++]);
+    int minGallop = runs.minGallop;
+
+    // merge until one run has no items left, or the first run has its last item left
+    [&] {
+        if (--len2 == 0 || len1 == 1) return;
+        while (true) {
+            int count1 = 0;     // number of times in a row that the first run won
+            int count2 = 0;     // number of times in a row that the second run won
+
+            // take one item at a time until one run starts winning consistently
+            do {
+                if (less(a[cursor2], tmp[cursor1])) {
+                    a[dest++] = std::move(a[cursor2++]);
+                    count2++;
+                    count1 = 0;
+                    if (--len2 == 0) return;
+                } else {
+                    a[dest++] = std::move(tmp[cursor1++]);
+                    count1++;
+                    count2 = 0;
+                    if (--len1 == 1) return;
+                }
+            } while ((count1 | count2) < minGallop);
+
+            // gallop until neither run is winning consistently
+            do {
+                count1 = gallopRight(a[cursor2], tmp, cursor1, len1, 0, less);
+                if (count1 != 0) {
+                    std::move(tmp.begin() + cursor1, tmp.begin() + cursor1 + count1, a.begin() + dest);
+                    dest += count1;
+                    cursor1 += count1;
+                    len1 -= count1;
+                    if (len1 <= 1) return;
+                }
+                a[dest++] = std::move(a[cursor2++]);
+                if (--len2 == 0) return;
+
+                count2 = gallopLeft(tmp[cursor1], a, cursor2, len2, 0, less);
+                if (count2 != 0) {
+                    std::move(a.begin() + cursor2, a.begin() + cursor2 + count2, a.begin() + dest);
+                    dest += count2;
+                    cursor2 += count2;
+                    len2 -= count2;
+                    if (len2 == 0) return;
+                }
+                a[dest++] = std::move(tmp[cursor1++]);
+                if (--len1 == 1) return;
+                minGallop--;
+            } while (count1 >= MIN_GALLOP || count2 >= MIN_GALLOP);
+
+            // penalize leaving gallop mode
+            if (minGallop < 0) minGallop = 0;
+            minGallop += 2;
+        }
+    }();
+    runs.minGallop = max(minGallop, 1);
+
+    if (len1 == 1) {
+        // the rest of the second run, then the last item of the first run
+        std::move(a.begin() + cursor2, a.begin() + cursor2 + len2, a.begin() + dest);
+        a[dest + len2] = std::move(tmp[cursor1]);
+    } else {
+        assert(len2 == 0 && len1 > 1);
+        std::move(tmp.begin() + cursor1, tmp.begin() + cursor1 + len1, a.begin() + dest);
+    }
+}
+
+template<typename T>
+requires Comparable<T>
+template<typename Less>
+void MergeSortBU<T>::mergeHi(Runs<Less> &runs, int base1, int len1, int base2, int len2) {
+    span<T> a = runs.a;
+    Less less = runs.less;
+
+    // copy the second run, which is the smaller one, into tmp
+    if ((int) runs.tmp.size() < len2) runs.tmp.resize(max(len2, min((int) a.size() / 2, 2 * len2)));
+    span<T> tmp = runs.tmp;
+    std::move(a.begin() + base2, a.begin() + base2 + len2, tmp.begin());
+
+    int cursor1 = base1 + len1 - 1;     // index into a
+    int cursor2 = len2 - 1;             // index into tmp
+    int dest = base2 + len2 - 1;        // index into a
+    a[dest--] = std::move(a[cursor1--]);
+    int minGallop = runs.minGallop;
+
+    // merge from the right until one run has no items left, or the second run has its first item left
+    [&] {
+        if (--len1 == 0 || len2 == 1) return;
+        while (true) {
+            int count1 = 0;     // number of times in a row that the first run won
+            int count2 = 0;     // number of times in a row that the second run won
+
+            // take one item at a time until one run starts winning consistently
+            do {
+                if (less(tmp[cursor2], a[cursor1])) {
+                    a[dest--] = std::move(a[cursor1--]);
+                    count1++;
+                    count2 = 0;
+                    if (--len1 == 0) return;
+                } else {
+                    a[dest--] = std::move(tmp[cursor2--]);
+                    count2++;
+                    count1 = 0;
+                    if (--len2 == 1) return;
+                }
+            } while ((count1 | count2) < minGallop);
+
+            // gallop until neither run is winning consistently
+            do {
+                count1 = len1 - gallopRight(tmp[cursor2], a, base1, len1, len1 - 1, less);
+                if (count1 != 0) {
+                    dest -= count1;
+                    cursor1 -= count1;
+                    len1 -= count1;
+                    move_backward(a.begin() + cursor1 + 1, a.begin() + cursor1 + 1 + count1,
+                                  a.begin() + dest + 1 + count1);
+                    if (len1 == 0) return;
+                }
+                a[dest--] = std::move(tmp[cursor2--]);
+                if (--len2 == 1) return;
+
+                count2 = len2 - gallopLeft(a[cursor1], tmp, 0, len2, len2 - 1, less);
+                if (count2 != 0) {
+                    dest -= count2;
+                    cursor2 -= count2;
+                    len2 -= count2;
+                    std::move(tmp.begin() + cursor2 + 1, tmp.begin() + cursor2 + 1 + count2, a.begin() + dest + 1);
+                    if (len2 <= 1) return;
+                }
+                a[dest--] = std::move(a[cursor1--]);
+                if (--len1 == 0) return;
+                minGallop--;
+            } while (count1 >= MIN_GALLOP || count2 >= MIN_GALLOP);
+
+            // penalize leaving gallop mode
+            if (minGallop < 0) minGallop = 0;
+            minGallop += 2;
+        }
+    }();
+    runs.minGallop = max(minGallop, 1);
+
+    if (len2 == 1) {
+        // the rest of the first run, then the first item of the second run
+        dest -= len1;
+        cursor1 -= len1;
+        move_backward(a.begin() + cursor1 + 1, a.begin() + cursor1 + 1 + len1, a.begin() + dest + 1 + len1);
+        a[dest] = std::move(tmp[cursor2]);
+    } else {
+        assert(len1 == 0 && len2 > 1);
+        std::move(tmp.begin(), tmp.begin() + len2, a.begin() + dest - (len2 - 1));
+    }
+}
+
+template<typename T>
+requires Comparable<T>
+template<typename Less>
+int MergeSortBU<T>::gallopLeft(const T &key, span<T> run, int base, int len, int hint, Less less) {
+    // gallop by offsets 1, 3, 7, ... until run[base+hint+lastOfs] < key <= run[base+hint+ofs]
+    int lastOfs = 0;
+    int ofs = 1;
+    if (less(run[base + hint], key)) {
+        int maxOfs = len - hint;
+        while (ofs < maxOfs && less(run[base + hint + ofs], key)) {
+            lastOfs = ofs;
+            ofs = min(2 * ofs + 1, maxOfs);
+        }
+        if (ofs > maxOfs) ofs = maxOfs;
+        lastOfs += hint;
+        ofs += hint;
+    } else {
+        int maxOfs = hint + 1;
+        while (ofs < maxOfs && !less(run[base + hint - ofs], key)) {
+            lastOfs = ofs;
+            ofs = min(2 * ofs + 1, maxOfs);
+        }
+        if (ofs > maxOfs) ofs = maxOfs;
+        int tmp = lastOfs;
+        lastOfs = hint - ofs;
+        ofs = hint - tmp;
+    }
+
+    // then binary search between the last two offsets
+    lastOfs++;
+    while (lastOfs < ofs) {
+        int m = lastOfs + (ofs - lastOfs) / 2;
+        if (less(run[base + m], key)) lastOfs = m + 1;
+        else ofs = m;
+    }
+    return ofs;
+}
+
+template<typename T>
+requires Comparable<T>
+template<typename Less>
+int MergeSortBU<T>::gallopRight(const T &key, span<T> run, int base, int len, int hint, Less less) {
+    // gallop by offsets 1, 3, 7, ... until run[base+hint+lastOfs] <= key < run[base+hint+ofs]
+    int lastOfs = 0;
+    int ofs = 1;
+    if (less(key, run[base + hint])) {
+        int maxOfs = hint + 1;
+        while (ofs < maxOfs && less(key, run[base + hint - ofs])) {
+            lastOfs = ofs;
+            ofs = min(2 * ofs + 1, maxOfs);
+        }
+        if (ofs > maxOfs) ofs = maxOfs;
+        int tmp = lastOfs;
+        lastOfs = hint - ofs;
+        ofs = hint - tmp;
+    } else {
+        int maxOfs = len - hint;
+        while (ofs < maxOfs && !less(key, run[base + hint + ofs])) {
+            lastOfs = ofs;
+            ofs = min(2 * ofs + 1, maxOfs);
+        }
+        if (ofs > maxOfs) ofs = maxOfs;
+        lastOfs += hint;
+        ofs += hint;
+    }
+
+    // then binary search between the last two offsets
+    lastOfs++;
+    while (lastOfs < ofs) {
+        int m = lastOfs + (ofs - lastOfs) / 2;
+        if (less(key, run[base + m])) ofs = m;
+        else lastOfs = m + 1;
+    }
+    return ofs;
+}
+
 template<typename T>
 requires Comparable<T>
 bool MergeSortBU<T>::isSorted(span<T> a, bool reverse) {
@@ -148,4 +677,40 @@ MergeSortBU(array<T, SIZE>, bool reverse) -> MergeSortBU<T>;
 template<typename T> requires Comparable<T>
 MergeSortBU(T a[], bool reverse) -> MergeSortBU<T>;
 
+template<typename T> requires Comparable<T>
+MergeSortBU(span<T>, MergeSortBUMode mode) -> MergeSortBU<T>;
+
+template<typename T> requires Comparable<T>
+MergeSortBU(vector<T>, MergeSortBUMode mode) -> MergeSortBU<T>;
+
+template<typename T, size_t SIZE> requires Comparable<T>
+MergeSortBU(array<T, SIZE>, MergeSortBUMode mode) -> MergeSortBU<T>;
+
+template<typename T> requires Comparable<T>
+MergeSortBU(span<T>, MergeSortBUMode mode, bool reverse) -> MergeSortBU<T>;
+
+template<typename T> requires Comparable<T>
+MergeSortBU(vector<T>, MergeSortBUMode mode, bool reverse) -> MergeSortBU<T>;
+
+template<typename T, size_t SIZE> requires Comparable<T>
+MergeSortBU(array<T, SIZE>, MergeSortBUMode mode, bool reverse) -> MergeSortBU<T>;
+
+template<typename T> requires Comparable<T>
+MergeSortBU(span<T>, span<T> buffer) -> MergeSortBU<T>;
+
+template<typename T> requires Comparable<T>
+MergeSortBU(vector<T>, span<T> buffer) -> MergeSortBU<T>;
+
+template<typename T> requires Comparable<T>
+MergeSortBU(vector<T>, vector<T> buffer) -> MergeSortBU<T>;
+
+template<typename T> requires Comparable<T>
+MergeSortBU(span<T>, span<T> buffer, bool reverse) -> MergeSortBU<T>;
+
+template<typename T> requires Comparable<T>
+MergeSortBU(vector<T>, span<T> buffer, bool reverse) -> MergeSortBU<T>;
+
+template<typename T> requires Comparable<T>
+MergeSortBU(vector<T>, vector<T> buffer, bool reverse) -> MergeSortBU<T>;
+
 #endif //ALGORITHMS_MERGESORTBU_HPP
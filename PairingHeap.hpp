@@ -0,0 +1,265 @@
+#ifndef ALGORITHMS_PAIRINGHEAP_HPP
+#define ALGORITHMS_PAIRINGHEAP_HPP
+
+#include <string>                   // std::string
+#include <sstream>                  // std::stringstream
+#include <vector>                   // std::vector
+#include <algorithm>                // std::sort
+#include <exception>                // std::exception
+#include <memory>                   // std::allocator_traits
+#include <utility>                  // std::move, std::swap
+#include "Comparable.hpp"           // includes Comparable concept used as a constraint
+#include "PoolAllocator.hpp"        // includes PoolAllocator
+#include <boost/lexical_cast.hpp>   // boost::lexical_cast
+
+using namespace std;
+
+/**
+ *  The {@code PairingHeap} class represents a priority queue of generic keys.
+ *  It supports the insert, delete-the-minimum and min operations of
+ *  {@code MinPQ}, and melding another priority queue into this one.
+ *
+ *  This implementation uses a pairing heap: a heap-ordered tree of any shape,
+ *  in which every node links to its first child and its next sibling. An
+ *  insertion or a meld links two roots with one compare; deleting the minimum
+ *  pairs up the children of the root from left to right and then links the
+ *  pairs from right to left into a single tree. Nodes are obtained from the
+ *  allocator parameter, rebound to the node type, which by default is a
+ *  {@code PoolAllocator}, so that the nodes of a heap lie in the contiguous
+ *  chunks of an arena and are recycled without reaching the system allocator.
+ *
+ *  The insert, meld, min, size and is-empty operations take Θ(1) time in the
+ *  worst case, and delete-the-minimum takes Θ(log(n)) amortized time. Melding
+ *  is only constant time when both heaps draw their nodes from the same arena,
+ *  that is when their allocators compare equal; otherwise the keys of the
+ *  other heap are moved into new nodes one at a time, in Θ(m) time for m keys.
+ *
+ *  @author Benjamin Chan
+ *
+ *  @param <T> the generic type of key on this priority queue
+ *  @param <Allocator> the allocator from which nodes are obtained
+ */
+template<typename T, typename Allocator = PoolAllocator<T>> requires Comparable<T>
+class PairingHeap {
+public:
+    /// Initializes an empty priority queue
+    PairingHeap() = default;
+
+    /// Initializes an empty priority queue whose nodes are obtained from the given allocator
+    explicit PairingHeap(const Allocator &alloc) : nodeAllocator(alloc) {};
+
+    /// Prevents the invocation of the constructor with an lvalue priority queue
+    PairingHeap(const PairingHeap<T, Allocator> &other) = delete;
+
+    /// Prevents the invocation of the constructor with an rvalue priority queue
+    PairingHeap(PairingHeap<T, Allocator> &&other) = delete;
+
+    /// Destructor deletes all nodes of a priority queue
+    ~PairingHeap() {
+        clear();
+    }
+
+    /**
+     * Returns true if this priority queue is empty.
+     *
+     * @return {@code true} if this priority queue is empty;
+     *         {@code false} otherwise
+     */
+    bool isEmpty() const {
+        return n == 0;
+    }
+
+    /**
+     * Returns the number of keys on this priority queue.
+     *
+     * @return the number of keys on this priority queue
+     */
+    int size() const {
+        return n;
+    }
+
+    /**
+     * Returns a smallest key on this priority queue.
+     *
+     * @return a smallest key on this priority queue
+     * @throws NoSuchElementException if this priority queue is empty
+     */
+    const T &min() const {
+        if (isEmpty()) throw NoSuchElementException();
+        return root->key;
+    }
+
+    /**
+     * Adds a new key to this priority queue.
+     *
+     * @param  x the new key to add to this priority queue
+     */
+    void insert(T x) {
+        Node *node = NodeTraits::allocate(nodeAllocator, 1);
+        ::new(static_cast<void *>(node)) Node{std::move(x)};
+        root = root == nullptr ? node : link(root, node);
+        n++;
+    }
+
+    /**
+     * Removes and returns a smallest key on this priority queue.
+     *
+     * @return a smallest key on this priority queue
+     * @throws NoSuchElementException if this priority queue is empty
+     */
+    T delMin() {
+        if (isEmpty()) throw NoSuchElementException();
+        Node *oldRoot = root;
+        T min = std::move(oldRoot->key);
+        root = mergePairs(oldRoot->child);
+        destroyNode(oldRoot);
+        n--;
+        return min;
+    }
+
+    /**
+     * Moves all keys of another priority queue into this one, leaving the other one empty.
+     * Takes constant time if the two priority queues share an arena.
+     *
+     * @param  other the priority queue to absorb
+     */
+    void meld(PairingHeap<T, Allocator> &&other) {
+        if (&other == this || other.root == nullptr) return;
+        if (nodeAllocator == other.nodeAllocator) {
+            root = root == nullptr ? other.root : link(root, other.root);
+            n += other.n;
+            other.root = nullptr;
+            other.n = 0;
+        } else {
+            // the nodes belong to the other arena: walk them as clear() does, and copy every key into a new node
+            vector<Node *> stack{other.root};
+            while (!stack.empty()) {
+                Node *node = stack.back();
+                stack.pop_back();
+                if (node->child != nullptr) stack.push_back(node->child);
+                if (node->sibling != nullptr) stack.push_back(node->sibling);
+                insert(std::move(node->key));
+            }
+            other.clear();
+        }
+    }
+
+    /**
+      * Returns a string representation of this priority queue.
+      *
+      * @return the sequence of keys in ascending order, separated by spaces
+      */
+    [[nodiscard]] std::string toString() const;
+
+    /**
+     * @def the NoSuchElementException if there are no items in the priority queue
+     */
+    struct NoSuchElementException : public std::exception {
+        [[nodiscard]] const char *what() const noexcept override {
+            return "Priority Queue Underflow";
+        }
+    };
+
+private:
+    struct Node {
+        T key;
+        Node *child = nullptr;      // the first child
+        Node *sibling = nullptr;    // the next sibling, or the next tree of a list of trees
+    };
+
+    /// the allocator rebound to the node type
+    using NodeAllocator = typename allocator_traits<Allocator>::template rebind_alloc<Node>;
+    using NodeTraits = allocator_traits<NodeAllocator>;
+
+    NodeAllocator nodeAllocator;    // the allocator from which nodes are obtained
+    Node *root = nullptr;           // the root of the tree, which holds a smallest key
+    int n = 0;                      // number of items on priority queue
+
+    // make the root that comes second a child of the other one, and return the new root
+    static Node *link(Node *a, Node *b) {
+        if (b->key < a->key) swap(a, b);
+        b->sibling = a->child;
+        a->child = b;
+        return a;
+    }
+
+    // link a list of sibling trees into one tree by the two-pass pairing
+    static Node *mergePairs(Node *first) {
+        // left to right, link the trees in pairs and push every pair onto a list
+        Node *pairs = nullptr;
+        while (first != nullptr) {
+            Node *a = first;
+            Node *b = a->sibling;
+            if (b == nullptr) {
+                a->sibling = pairs;
+                pairs = a;
+                break;
+            }
+            first = b->sibling;
+            a->sibling = b->sibling = nullptr;
+            Node *pair = link(a, b);
+            pair->sibling = pairs;
+            pairs = pair;
+        }
+
+        // right to left, link every pair into the tree of the pairs to its right
+        Node *tree = nullptr;
+        while (pairs != nullptr) {
+            Node *next = pairs->sibling;
+            pairs->sibling = nullptr;
+            tree = tree == nullptr ? pairs : link(tree, pairs);
+            pairs = next;
+        }
+        return tree;
+    }
+
+    // destroy and deallocate a node
+    void destroyNode(Node *node) {
+        node->~Node();
+        NodeTraits::deallocate(nodeAllocator, node, 1);
+    }
+
+    // destroy all nodes, without recursion since a tree may be a long path
+    void clear() {
+        vector<Node *> stack;
+        if (root != nullptr) stack.push_back(root);
+        while (!stack.empty()) {
+            Node *node = stack.back();
+            stack.pop_back();
+            if (node->child != nullptr) stack.push_back(node->child);
+            if (node->sibling != nullptr) stack.push_back(node->sibling);
+            destroyNode(node);
+        }
+        root = nullptr;
+        n = 0;
+    }
+};
+
+template<typename T, typename Allocator>
+requires Comparable<T>
+std::string PairingHeap<T, Allocator>::toString() const {
+    vector<T> keys;
+    vector<const Node *> stack;
+    if (root != nullptr) stack.push_back(root);
+    while (!stack.empty()) {
+        const Node *node = stack.back();
+        stack.pop_back();
+        keys.push_back(node->key);
+        if (node->child != nullptr) stack.push_back(node->child);
+        if (node->sibling != nullptr) stack.push_back(node->sibling);
+    }
+    sort(keys.begin(), keys.end());
+    std::stringstream ss;
+    for (const T &key: keys)
+        ss << boost::lexical_cast<std::string>(key) << " ";
+    ss << endl;
+    return ss.str();
+}
+
+/// Overloads the "<<" operator for a pairing heap
+template<typename T, typename Allocator>
+std::ostream &operator<<(std::ostream &os, const PairingHeap<T, Allocator> &pairingHeap) {
+    return os << pairingHeap.toString();
+}
+
+#endif //ALGORITHMS_PAIRINGHEAP_HPP
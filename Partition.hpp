@@ -0,0 +1,162 @@
+#ifndef ALGORITHMS_PARTITION_HPP
+#define ALGORITHMS_PARTITION_HPP
+
+#include <span>                 // std::span
+#include <algorithm>            // std::min
+#include <utility>              // std::swap
+
+using namespace std;
+
+/**
+ *  The partitioning routines shared by {@code QuickSort} and {@code QuickSelect}.
+ *
+ *  Each routine orders items by {@code less}, which is {@code std::less<T>} for
+ *  an ascending order and {@code std::greater<T>} for a descending one, so the
+ *  comparison is inlined and decided once per call instead of once per compare.
+ *
+ *  @author Benjamin Chan
+ */
+
+/// the ways {@code QuickSort} and {@code QuickSelect} choose and partition around their partitioning items
+enum class QuickSortMode {
+    // shuffle first, then partition on the first item
+    Shuffled,
+    // partition on the median of three or the ninther, and bound the recursion depth
+    Introsort,
+    // as Introsort, but partition with the branchless block partition
+    BlockIntrosort
+};
+
+// cutoff from the median of three to the ninther
+static constexpr int MEDIAN_OF_3_CUTOFF = 40;
+
+// the number of items whose comparisons are buffered at a time by blockPartition
+static constexpr int PARTITION_BLOCK = 64;
+
+/**
+ * Returns the index of the median of {@code a[i]}, {@code a[j]} and {@code a[k]}.
+ */
+template<typename T, typename Less>
+int median3(span<T> a, int i, int j, int k, Less less) {
+    return (less(a[i], a[j]) ?
+            (less(a[j], a[k]) ? j : less(a[i], a[k]) ? k : i) :
+            (less(a[k], a[j]) ? j : less(a[k], a[i]) ? k : i));
+}
+
+/**
+ * Returns the index of a partitioning item for {@code a[lo..hi]}: the median of
+ * the first, middle and last items, or Tukey's ninther (the median of three
+ * medians of three) for subarrays longer than 40.
+ */
+template<typename T, typename Less>
+int medianPivot(span<T> a, int lo, int hi, Less less) {
+    int n = hi - lo + 1;
+    int m = lo + n / 2;
+    if (n <= MEDIAN_OF_3_CUTOFF) return median3(a, lo, m, hi, less);
+    int eps = n / 8;
+    int m1 = median3(a, lo, lo + eps, lo + eps + eps, less);
+    int m2 = median3(a, m - eps, m, m + eps, less);
+    int m3 = median3(a, hi - eps - eps, hi - eps, hi, less);
+    return median3(a, m1, m2, m3, less);
+}
+
+/**
+ * Partitions {@code a[lo..hi]} around the partitioning item {@code a[lo]} by
+ * scanning inwards from both ends, and returns the final index {@code j} of
+ * the partitioning item, so that {@code a[lo..j-1] <= a[j] <= a[j+1..hi]}.
+ */
+template<typename T, typename Less>
+int hoarePartition(span<T> a, int lo, int hi, Less less) {
+    int i = lo;
+    int j = hi + 1;
+    T v = a[lo];
+    while (true) {
+
+        // find item on lo to swap
+        while (less(a[++i], v)) {
+            if (i == hi) break;
+        }
+
+        // find item on hi to swap
+        while (less(v, a[--j])) {
+            if (j == lo) break;
+        }
+
+        // check if pointers cross
+        if (i >= j) break;
+
+        swap(a[i], a[j]);
+    }
+
+    // put partitioning item v at a[j]
+    swap(a[lo], a[j]);
+    return j;
+}
+
+/**
+ * Partitions {@code a[lo..hi]} around the partitioning item {@code a[lo]} like
+ * {@code hoarePartition}, but without a branch per comparison.
+ *
+ * This is the block partition of Edelkamp and Weiß (BlockQuicksort). A block
+ * of 64 items is taken from each end of the unpartitioned middle. The offsets
+ * of the items on the wrong side of each block are written into a buffer
+ * unconditionally, and the buffer length grows by the 0 or 1 result of the
+ * comparison, so the comparison never steers a branch. The misplaced items of
+ * the two blocks are then swapped pairwise, and an exhausted block is
+ * replaced by the next one. The few remaining items are finished by the scan
+ * of {@code hoarePartition}.
+ */
+template<typename T, typename Less>
+int blockPartition(span<T> a, int lo, int hi, Less less) {
+    T v = a[lo];
+
+    // a[lo+1..l-1] <= v, a[r+1..hi] >= v, and a[l..r] is not yet partitioned
+    int l = lo + 1;
+    int r = hi;
+    unsigned char offsetsL[PARTITION_BLOCK];
+    unsigned char offsetsR[PARTITION_BLOCK];
+    int startL = 0, numL = 0;
+    int startR = 0, numR = 0;
+    while (r - l + 1 >= 2 * PARTITION_BLOCK) {
+        if (numL == 0) {
+            startL = 0;
+            for (int i = 0; i < PARTITION_BLOCK; i++) {
+                offsetsL[numL] = (unsigned char) i;
+                numL += !less(a[l + i], v);
+            }
+        }
+        if (numR == 0) {
+            startR = 0;
+            for (int i = 0; i < PARTITION_BLOCK; i++) {
+                offsetsR[numR] = (unsigned char) i;
+                numR += !less(v, a[r - i]);
+            }
+        }
+
+        int num = min(numL, numR);
+        for (int i = 0; i < num; i++)
+            swap(a[l + offsetsL[startL + i]], a[r - offsetsR[startR + i]]);
+        numL -= num;
+        numR -= num;
+        startL += num;
+        startR += num;
+        if (numL == 0) l += PARTITION_BLOCK;
+        if (numR == 0) r -= PARTITION_BLOCK;
+    }
+
+    // a block with misplaced items left over is still within a[l..r], so scan it again
+    int i = l;
+    int j = r;
+    while (true) {
+        while (i <= j && less(a[i], v)) i++;
+        while (i <= j && less(v, a[j])) j--;
+        if (i >= j) break;
+        swap(a[i++], a[j--]);
+    }
+
+    // now a[lo+1..j] <= v <= a[j+1..hi]; put partitioning item v at a[j]
+    swap(a[lo], a[j]);
+    return j;
+}
+
+#endif //ALGORITHMS_PARTITION_HPP
@@ -0,0 +1,24 @@
+#include "PoolAllocator.hpp"
+
+NodePool::NodePool(size_t blockSize) : chunkBlocks(FIRST_CHUNK), next(nullptr), end(nullptr), freeList(nullptr) {
+    // every block must be able to hold a free list link and keep the next block aligned
+    size_t alignment = alignof(max_align_t);
+    if (blockSize < sizeof(FreeBlock)) blockSize = sizeof(FreeBlock);
+    this->blockSize = (blockSize + alignment - 1) / alignment * alignment;
+}
+
+void NodePool::grow() {
+    // operator new[] for byte returns storage aligned for any fundamental type
+    chunks.emplace_back(new byte[chunkBlocks * blockSize]);
+    next = chunks.back().get();
+    end = next + chunkBlocks * blockSize;
+    if (chunkBlocks < MAX_CHUNK) chunkBlocks *= 2;
+}
+
+NodePool &NodeArena::poolFor(size_t size) {
+    size_t alignment = alignof(max_align_t);
+    size_t index = size == 0 ? 0 : (size - 1) / alignment;
+    if (index >= pools.size()) pools.resize(index + 1);
+    if (pools[index] == nullptr) pools[index] = make_unique<NodePool>((index + 1) * alignment);
+    return *pools[index];
+}
@@ -0,0 +1,265 @@
+#ifndef ALGORITHMS_POOLALLOCATOR_HPP
+#define ALGORITHMS_POOLALLOCATOR_HPP
+
+#include <cstddef>                  // std::size_t, std::byte
+#include <memory>                   // std::allocator, std::shared_ptr, std::unique_ptr
+#include <vector>                   // std::vector
+#include <new>                      // std::align_val_t
+
+using namespace std;
+
+/**
+ *  The {@code NodePool} class hands out fixed-size blocks carved from
+ *  contiguous chunks. Freed blocks are recycled through an intrusive free list,
+ *  so after warm-up an allocation or deallocation is a couple of pointer moves
+ *  and never reaches the system allocator. Consecutive allocations are adjacent
+ *  in memory, so nodes linked in allocation order are also traversed in order.
+ *
+ *  Chunks double in size up to a fixed maximum and are only released when the
+ *  pool is destroyed.
+ *
+ *  This class is not thread-safe.
+ *
+ *  @author Benjamin Chan
+ */
+class NodePool {
+public:
+    /**
+     * Initializes an empty pool of blocks.
+     *
+     * @param blockSize the size of every block in bytes
+     */
+    explicit NodePool(size_t blockSize);
+
+    /// Prevents the invocation of the constructor with an lvalue pool
+    NodePool(const NodePool &other) = delete;
+
+    /// Prevents the invocation of the constructor with an rvalue pool
+    NodePool(NodePool &&other) = delete;
+
+    /**
+     * Returns a block of {@code blockSize} bytes.
+     *
+     * @return a pointer to an unused block
+     */
+    inline void *allocate() {
+        if (freeList != nullptr) {
+            FreeBlock *block = freeList;
+            freeList = block->next;
+            return block;
+        }
+        if (next == end) grow();
+        void *block = next;
+        next += blockSize;
+        return block;
+    }
+
+    /**
+     * Returns a block to this pool.
+     *
+     * @param p a block previously returned by {@code allocate()}
+     */
+    inline void deallocate(void *p) {
+        auto *block = static_cast<FreeBlock *>(p);
+        block->next = freeList;
+        freeList = block;
+    }
+
+private:
+    struct FreeBlock {
+        FreeBlock *next;
+    };
+
+    /// the number of blocks in the first chunk and the maximum number per chunk
+    static constexpr size_t FIRST_CHUNK = 64;
+    static constexpr size_t MAX_CHUNK = 1 << 16;
+
+    /// the size of every block, rounded up to the maximum fundamental alignment
+    size_t blockSize;
+
+    /// the number of blocks in the next chunk
+    size_t chunkBlocks;
+
+    /// all chunks, released when the pool is destroyed
+    vector<unique_ptr<byte[]>> chunks;
+
+    /// the unused tail of the current chunk
+    byte *next;
+    byte *end;
+
+    /// the recycled blocks
+    FreeBlock *freeList;
+
+    /// allocates a new chunk
+    void grow();
+};
+
+/**
+ *  The {@code NodeArena} class owns one {@code NodePool} per block size, so
+ *  containers whose nodes have the same size share the same chunks and free list.
+ *
+ *  This class is not thread-safe.
+ *
+ *  @author Benjamin Chan
+ */
+class NodeArena {
+public:
+    NodeArena() = default;
+
+    /// Prevents the invocation of the constructor with an lvalue arena
+    NodeArena(const NodeArena &other) = delete;
+
+    /**
+     * Returns the pool serving blocks of the given size.
+     *
+     * @param size the size of a block in bytes
+     * @return the pool serving blocks of {@code size} bytes
+     */
+    NodePool &poolFor(size_t size);
+
+private:
+    /// pools[i] serves blocks of at most (i + 1) * alignof(max_align_t) bytes
+    vector<unique_ptr<NodePool>> pools;
+};
+
+/**
+ *  The {@code PoolAllocator} class is a standard allocator that serves
+ *  single-object allocations from a {@code NodeArena}, and forwards array
+ *  allocations to {@code std::allocator}, as well as every allocation of a
+ *  type aligned more strictly than the blocks of the arena, which are aligned
+ *  to {@code alignof(max_align_t)}. It is meant for the node-based
+ *  containers ({@code Stack}, {@code Queue} and {@code Bag}), which take it as
+ *  their allocator parameter:
+ *
+ *      PoolAllocator<string> alloc;
+ *      Stack<string, PoolAllocator<string>> stack(alloc);
+ *      Queue<string, PoolAllocator<string>> queue(alloc);
+ *
+ *  Copies and rebinds of an allocator share its arena, so the stack and the
+ *  queue above draw their nodes from the same chunks. The arena is released
+ *  when the last allocator sharing it is destroyed.
+ *
+ *  @author Benjamin Chan
+ *
+ *  @param <T> the type of object allocated
+ */
+template<typename T>
+class PoolAllocator {
+public:
+    using value_type = T;
+
+    /// Initializes an allocator with a new arena
+    PoolAllocator() : arena(make_shared<NodeArena>()), pool(nullptr) {};
+
+    /// Initializes an allocator that shares the arena of another allocator
+    template<typename U>
+    PoolAllocator(const PoolAllocator<U> &other) : arena(other.arena), pool(nullptr) {};
+
+    /**
+     * Allocates uninitialized storage for n objects.
+     *
+     * @param n the number of objects
+     * @return a pointer to the storage
+     */
+    T *allocate(size_t n) {
+        if (n != 1 || !POOLED) return allocator<T>().allocate(n);
+        if (pool == nullptr) pool = &arena->poolFor(sizeof(T));
+        return static_cast<T *>(pool->allocate());
+    }
+
+    /**
+     * Releases storage obtained from {@code allocate(n)}.
+     *
+     * @param p the storage
+     * @param n the number of objects it was allocated for
+     */
+    void deallocate(T *p, size_t n) {
+        if (n != 1 || !POOLED) {
+            allocator<T>().deallocate(p, n);
+            return;
+        }
+        if (pool == nullptr) pool = &arena->poolFor(sizeof(T));
+        pool->deallocate(p);
+    }
+
+    template<typename U>
+    bool operator==(const PoolAllocator<U> &other) const {
+        return arena == other.arena;
+    }
+
+    template<typename U>
+    bool operator!=(const PoolAllocator<U> &other) const {
+        return arena != other.arena;
+    }
+
+private:
+    template<typename U> friend
+    class PoolAllocator;
+
+    /// whether single objects come from the arena; an over-aligned type gets aligned storage from std::allocator
+    static constexpr bool POOLED = alignof(T) <= alignof(max_align_t);
+
+    /// the arena shared by all copies and rebinds of this allocator
+    shared_ptr<NodeArena> arena;
+
+    /// the pool serving blocks of sizeof(T), looked up on first use
+    NodePool *pool;
+};
+
+/**
+ *  The {@code CacheAlignedAllocator} class is a standard allocator whose
+ *  storage starts on a cache line boundary. It is meant for arrays whose
+ *  layout is planned around cache lines, such as the d-ary heaps of
+ *  {@code MinPQ} and {@code MaxPQ}, which keep the children of a node in one line:
+ *
+ *      vector<int, CacheAlignedAllocator<int>> heap;
+ *
+ *  @author Benjamin Chan
+ *
+ *  @param <T> the type of object allocated
+ */
+template<typename T>
+class CacheAlignedAllocator {
+public:
+    using value_type = T;
+
+    /// the size of a cache line in bytes
+    static constexpr size_t CACHE_LINE = 64;
+
+    CacheAlignedAllocator() = default;
+
+    template<typename U>
+    CacheAlignedAllocator(const CacheAlignedAllocator<U> &) {};
+
+    /**
+     * Allocates uninitialized storage for n objects, starting on a cache line boundary.
+     *
+     * @param n the number of objects
+     * @return a pointer to the storage
+     */
+    T *allocate(size_t n) {
+        return static_cast<T *>(::operator new(n * sizeof(T), align_val_t(CACHE_LINE)));
+    }
+
+    /**
+     * Releases storage obtained from {@code allocate(n)}.
+     *
+     * @param p the storage
+     * @param n the number of objects it was allocated for
+     */
+    void deallocate(T *p, size_t n) {
+        ::operator delete(p, n * sizeof(T), align_val_t(CACHE_LINE));
+    }
+
+    template<typename U>
+    bool operator==(const CacheAlignedAllocator<U> &) const {
+        return true;
+    }
+
+    template<typename U>
+    bool operator!=(const CacheAlignedAllocator<U> &) const {
+        return false;
+    }
+};
+
+#endif //ALGORITHMS_POOLALLOCATOR_HPP
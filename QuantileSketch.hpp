@@ -0,0 +1,277 @@
+#ifndef ALGORITHMS_QUANTILESKETCH_HPP
+#define ALGORITHMS_QUANTILESKETCH_HPP
+
+#include <span>                     // std::span
+#include <vector>                   // std::vector
+#include <utility>                  // std::pair
+#include <algorithm>                // std::sort, std::min, std::max
+#include <cmath>                    // std::pow, std::ceil
+#include <random>                   // std::random_device, std::mt19937
+#include <exception>                // std::exception
+#include <stdexcept>                // std::invalid_argument
+#include "Comparable.hpp"           // includes Comparable concept used as a constraint
+
+using namespace std;
+
+/**
+ *  The {@code QuantileSketch} class summarizes a stream of generic keys of any
+ *  length in bounded memory, and answers approximate quantile and rank
+ *  queries about it. Sketches of different parts of a stream, for example
+ *  one per thread, merge into a sketch of the whole stream.
+ *
+ *  This implementation is the KLL sketch of Karnin, Lang and Liberty. The
+ *  keys are kept in compactors of increasing height, where a key of height h
+ *  stands for 2^h keys of the stream. A new key goes into the compactor of
+ *  height 0. When a compactor is full, it is sorted, and every other key,
+ *  starting from the first or the second at random, moves up one height; the
+ *  rest are dropped. The capacity of a compactor is k at the top and shrinks
+ *  by a factor 2/3 per height below it, down to 8, so the sketch keeps fewer
+ *  than 3k + 8 log(n / k) keys. The rank of a key is estimated to within about
+ *  1% of n for the default k = 200 with high probability, and the error
+ *  shrinks in proportion to 1 / k. The smallest and the largest keys are kept
+ *  exactly.
+ *
+ *  Half of the keys sorted by a compactor move up, so about 2n keys are
+ *  sorted in all, in arrays of at most k keys, and the insert operation takes
+ *  Θ(log(k)) amortized time, which is constant for a fixed k. Merging takes
+ *  Θ(k log(k)) time. A query sorts the keys of the sketch, in Θ(k log(k))
+ *  time; several quantiles are answered together by one call to
+ *  {@code quantiles}.
+ *
+ *  @author Benjamin Chan
+ *
+ *  @param <T> the generic type of a key
+ */
+template<typename T> requires Comparable<T>
+class QuantileSketch {
+public:
+    /**
+     * Initializes an empty sketch.
+     *
+     * @param  k the capacity of the top compactor, which sets the accuracy
+     * @param  seed the seed of the coin that chooses which keys of a compactor move up
+     * @throws invalid_argument if {@code k < 8}
+     */
+    explicit QuantileSketch(int k = 200, unsigned int seed = random_device()()) : k(k), coin(seed) {
+        if (k < 8) throw invalid_argument("k is less than eight.");
+        grow();
+    }
+
+    /**
+     * Returns true if no key has been inserted.
+     *
+     * @return {@code true} if no key has been inserted; {@code false} otherwise
+     */
+    bool isEmpty() const {
+        return n == 0;
+    }
+
+    /**
+     * Returns the number of keys inserted into this sketch and the sketches merged into it.
+     *
+     * @return the number of keys summarized
+     */
+    long count() const {
+        return n;
+    }
+
+    /**
+     * Returns the number of keys the sketch keeps.
+     *
+     * @return the number of keys kept
+     */
+    int retained() const {
+        return retainedKeys;
+    }
+
+    /**
+     * Adds a key to the sketch.
+     *
+     * @param  x the key
+     */
+    void insert(const T &x) {
+        if (n == 0 || x < smallest) smallest = x;
+        if (n == 0 || largest < x) largest = x;
+        n++;
+        compactors[0].push_back(x);
+        if (++retainedKeys >= maxRetained) compress();
+    }
+
+    /**
+     * Adds a batch of keys to the sketch.
+     *
+     * @param  keys the keys
+     */
+    void insertBatch(span<const T> keys) {
+        for (const T &x: keys) insert(x);
+    }
+
+    /**
+     * Merges another sketch into this one, which then summarizes the keys of both.
+     *
+     * @param  other the sketch to merge
+     */
+    void merge(const QuantileSketch<T> &other);
+
+    /**
+     * Returns an estimate of the number of keys inserted that are strictly less than {@code key}.
+     *
+     * @param  key the key
+     * @return the estimated rank of {@code key}
+     */
+    long rank(const T &key) const;
+
+    /**
+     * Returns an estimate of the key of the given quantile: a key that is
+     * greater than about a fraction q of the keys inserted.
+     *
+     * @param  q the quantile, between 0 and 1
+     * @return the estimated key of quantile q; the smallest key for 0 and the largest for 1
+     * @throws invalid_argument unless {@code 0 <= q <= 1}
+     * @throws NoSuchElementException if no key has been inserted
+     */
+    T quantile(double q) const {
+        return quantiles(span<const double>(&q, 1))[0];
+    }
+
+    /**
+     * Returns estimates of the keys of several quantiles, with one sort of the sketch.
+     *
+     * @param  qs the quantiles, each between 0 and 1, in any order
+     * @return the estimated keys of the quantiles, in the order of {@code qs}
+     * @throws invalid_argument unless {@code 0 <= q <= 1} for every quantile
+     * @throws NoSuchElementException if no key has been inserted
+     */
+    vector<T> quantiles(span<const double> qs) const;
+
+    /**
+     * @def the NoSuchElementException if a quantile of an empty sketch is requested
+     */
+    struct NoSuchElementException : public std::exception {
+        [[nodiscard]] const char *what() const noexcept override {
+            return "Quantile Sketch Underflow";
+        }
+    };
+
+private:
+    // the smallest capacity of a compactor, so that the bottom ones are not compacted for every few keys
+    static constexpr int MIN_CAPACITY = 8;
+
+    int k;                              // the capacity of the top compactor
+    mt19937 coin;                       // chooses which keys of a compactor move up
+    vector<vector<T>> compactors;       // compactors[h] holds keys of weight 2^h
+    vector<int> capacities;             // capacities[h] is the capacity of compactors[h]
+    long n = 0;                         // the number of keys summarized
+    int retainedKeys = 0;               // the number of keys in all compactors
+    int maxRetained = 0;                // the sum of the capacities of the compactors
+    T smallest{};                       // the smallest key summarized
+    T largest{};                        // the largest key summarized
+
+    // add a compactor on top, which lowers the capacities of those below to 2/3 of the one above,
+    // but not below MIN_CAPACITY
+    void grow() {
+        compactors.emplace_back();
+        int height = (int) compactors.size();
+        capacities.resize(height);
+        maxRetained = 0;
+        for (int h = 0; h < height; h++) {
+            capacities[h] = max(MIN_CAPACITY, (int) ceil(pow(2.0 / 3.0, height - h - 1) * k));
+            maxRetained += capacities[h];
+        }
+    }
+
+    // compact full compactors from the bottom until the sketch is within its capacity
+    void compress();
+
+    // the keys of the sketch with their weights, in ascending order of key
+    vector<pair<T, long>> weightedKeys() const;
+};
+
+template<typename T>
+requires Comparable<T>
+void QuantileSketch<T>::compress() {
+    for (int h = 0; h < (int) compactors.size(); h++) {
+        if ((int) compactors[h].size() < capacities[h]) continue;
+        if (h + 1 == (int) compactors.size()) grow();
+
+        // keep every other key from a random start, and leave the last key of an odd compactor behind
+        vector<T> &compactor = compactors[h];
+        sort(compactor.begin(), compactor.end());
+        int pairs = (int) compactor.size() / 2;
+        int start = (int) (coin() & 1);
+        for (int i = 0; i < pairs; i++)
+            compactors[h + 1].push_back(compactor[2 * i + start]);
+        bool odd = compactor.size() % 2 == 1;
+        if (odd) compactor[0] = compactor.back();
+        compactor.resize(odd ? 1 : 0);
+        retainedKeys -= pairs;
+        if (retainedKeys < maxRetained) break;
+    }
+}
+
+template<typename T>
+requires Comparable<T>
+void QuantileSketch<T>::merge(const QuantileSketch<T> &other) {
+    if (other.n == 0) return;
+    if (n == 0 || other.smallest < smallest) smallest = other.smallest;
+    if (n == 0 || largest < other.largest) largest = other.largest;
+    n += other.n;
+    while (compactors.size() < other.compactors.size()) grow();
+    for (int h = 0; h < (int) other.compactors.size(); h++)
+        compactors[h].insert(compactors[h].end(), other.compactors[h].begin(), other.compactors[h].end());
+    retainedKeys += other.retainedKeys;
+    while (retainedKeys >= maxRetained) compress();
+}
+
+template<typename T>
+requires Comparable<T>
+long QuantileSketch<T>::rank(const T &key) const {
+    long rank = 0;
+    for (int h = 0; h < (int) compactors.size(); h++)
+        for (const T &x: compactors[h])
+            if (x < key) rank += 1L << h;
+    return rank;
+}
+
+template<typename T>
+requires Comparable<T>
+vector<pair<T, long>> QuantileSketch<T>::weightedKeys() const {
+    vector<pair<T, long>> keys;
+    keys.reserve(retainedKeys);
+    for (int h = 0; h < (int) compactors.size(); h++)
+        for (const T &x: compactors[h]) keys.emplace_back(x, 1L << h);
+    sort(keys.begin(), keys.end(), [](const auto &a, const auto &b) { return a.first < b.first; });
+    return keys;
+}
+
+template<typename T>
+requires Comparable<T>
+vector<T> QuantileSketch<T>::quantiles(span<const double> qs) const {
+    for (double q: qs)
+        if (!(q >= 0 && q <= 1)) throw invalid_argument("quantile is not between 0 and 1: " + to_string(q));
+    if (isEmpty()) throw NoSuchElementException();
+
+    // the weights of the kept keys add up to about n; the key of quantile q is the first whose
+    // cumulative weight exceeds q times the total
+    vector<pair<T, long>> keys = weightedKeys();
+    long total = 0;
+    for (const auto &[key, weight]: keys) total += weight;
+    vector<T> result;
+    result.reserve(qs.size());
+    for (double q: qs) {
+        if (q == 0) {
+            result.push_back(smallest);
+        } else if (q == 1) {
+            result.push_back(largest);
+        } else {
+            long target = (long) (q * total);
+            long cumulative = 0;
+            size_t i = 0;
+            while (i + 1 < keys.size() && cumulative + keys[i].second <= target) cumulative += keys[i++].second;
+            result.push_back(keys[i].first);
+        }
+    }
+    return result;
+}
+
+#endif //ALGORITHMS_QUANTILESKETCH_HPP
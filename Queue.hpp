@@ -5,6 +5,7 @@
 #include <sstream>                  // std::stringstream
 #include <iostream>                 // std::cout
 #include <exception>                // std::exception
+#include <memory>                   // std::allocator, std::allocator_traits
 #include <boost/lexical_cast.hpp>   // boost::lexical_cast
 
 /**
@@ -16,6 +17,9 @@
  *  the items in FIFO order.
  *
  *  This implementation uses a singly linked list with a nested class Node.
+ *  Nodes are obtained from the allocator parameter, rebound to the node type;
+ *  use {@code PoolAllocator} to draw them from contiguous recycled chunks
+ *  instead of a heap allocation per item.
  *
  *  @author Benjamin Chan
  *
@@ -26,8 +30,9 @@
  *  https://algs4.cs.princeton.edu/41graph/Queue.java.html.
  *
  *  @param <T> the generic type of an item in this queue
+ *  @param <Allocator> the allocator from which nodes are obtained
  */
-template<typename T>
+template<typename T, typename Allocator = std::allocator<T>>
 class Queue {
 private:
     /**
@@ -49,20 +54,22 @@ public:
     /// Initializes an empty queue
     Queue() : n(0), first(nullptr), last(nullptr) {};
 
+    /// Initializes an empty queue whose nodes are obtained from the given allocator
+    explicit Queue(const Allocator &alloc) : n(0), first(nullptr), last(nullptr), nodeAllocator(alloc) {};
+
     /// Prevents the invocation of the constructor with an lvalue queue
-    Queue(const Queue<T> &other) = delete;
+    Queue(const Queue<T, Allocator> &other) = delete;
 
     /// Prevents the invocation of the constructor with an rvalue queue
-    Queue(Queue<T> &&other) = delete;
+    Queue(Queue<T, Allocator> &&other) = delete;
 
     /// Destructor deletes all allocated items of a queue
     ~Queue() {
-        while (first->next != nullptr) {
+        while (first != nullptr) {
             Node *temp = first;
             first = first->next;
-            delete temp;
+            destroyNode(temp);
         }
-        delete first;
     };
 
     /**
@@ -115,7 +122,7 @@ public:
 
     /// Nested iterator class
     class Iterator {
-        friend class Queue<T>;
+        friend class Queue<T, Allocator>;
 
     private:
         Node *nodePtr;
@@ -166,7 +173,7 @@ public:
      * @return an iterator that points to the past-the-end node after the last node of the queue
      */
     inline Iterator end() const {
-        return Iterator(last->next);
+        return Iterator(nullptr);
     }
 
 private:
@@ -191,11 +198,31 @@ private:
 
     /// the last node in a queue
     Node *last;
+
+    /// the allocator rebound to the node type
+    using NodeAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+    using NodeTraits = std::allocator_traits<NodeAllocator>;
+
+    /// the allocator from which nodes are obtained
+    NodeAllocator nodeAllocator;
+
+    /// allocates and constructs a node
+    template<typename... Args>
+    Node *createNode(Args &&... args) {
+        Node *node = NodeTraits::allocate(nodeAllocator, 1);
+        return ::new(static_cast<void *>(node)) Node(std::forward<Args>(args)...);
+    }
+
+    /// destroys and deallocates a node
+    void destroyNode(Node *node) {
+        node->~Node();
+        NodeTraits::deallocate(nodeAllocator, node, 1);
+    }
 };
 
 
-template<typename T>
-T Queue<T>::peek() {
+template<typename T, typename Allocator>
+T Queue<T, Allocator>::peek() {
     try {
         if (isEmpty()) throw NoSuchElementException();
         return this->first.item;
@@ -206,10 +233,10 @@ T Queue<T>::peek() {
     }
 }
 
-template<typename T>
-void Queue<T>::enqueue(T item) {
+template<typename T, typename Allocator>
+void Queue<T, Allocator>::enqueue(T item) {
     Node *oldLast = last;
-    last = new Node(item);
+    last = createNode(item);
     if (isEmpty()) {
         first = last;
     } else
@@ -217,14 +244,14 @@ void Queue<T>::enqueue(T item) {
     n++;
 }
 
-template<typename T>
-T Queue<T>::dequeue() {
+template<typename T, typename Allocator>
+T Queue<T, Allocator>::dequeue() {
     try {
         if (isEmpty()) throw NoSuchElementException();
         Node *oldFirst = first;
         T item = first->item;
         first = first->next;
-        delete oldFirst;
+        destroyNode(oldFirst);
         n--;
         return item;
     }
@@ -235,8 +262,8 @@ T Queue<T>::dequeue() {
     }
 }
 
-template<typename T>
-std::string Queue<T>::toString() const {
+template<typename T, typename Allocator>
+std::string Queue<T, Allocator>::toString() const {
     std::stringstream ss;
     for (const auto &item: *this) {
         ss << boost::lexical_cast<std::string>(item) << " ";
@@ -246,8 +273,8 @@ std::string Queue<T>::toString() const {
 }
 
 /// Overloads the "<<" operator for a queue
-template<typename T>
-std::ostream &operator<<(std::ostream &os, const Queue<T> &queue) {
+template<typename T, typename Allocator>
+std::ostream &operator<<(std::ostream &os, const Queue<T, Allocator> &queue) {
     return os << queue.toString();
 }
 
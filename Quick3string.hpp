@@ -0,0 +1,173 @@
+#ifndef ALGORITHMS_QUICK3STRING_HPP
+#define ALGORITHMS_QUICK3STRING_HPP
+
+#include <span>                 // std::span
+#include <array>                // std::array
+#include <vector>               // std::vector
+#include <string>               // std::string
+#include <string_view>          // std::string_view
+#include <concepts>             // std::same_as
+#include <utility>              // std::swap
+#include <cassert>              // std::assert
+
+using namespace std;
+
+/**
+ * Checks if the class is a string of chars that the string sorts can index
+ * character by character.
+ *
+ * @throws an error at compile-time if this constraint is violated
+ */
+template<typename T>
+concept CharString = same_as<T, string> || same_as<T, string_view>;
+
+template<typename T> requires CharString<T>
+class MSD;
+
+/**
+ *  The {@code Quick3string} class provides a public method for sorting a
+ *  container of strings, using 3-way radix quicksort (multikey quicksort).
+ *
+ *  Unlike {@code QuickSort3way}, which partitions on whole keys and so
+ *  compares the common prefixes of the keys again at every level, this sort
+ *  partitions on one character at a time: the strings are split into those
+ *  whose d-th character is less than, equal to, and greater than that of the
+ *  partitioning string, and only the middle part goes on to character d + 1.
+ *  The partitioning string is the median of three instead of the product of a
+ *  shuffle, and subarrays of at most 15 strings are finished by insertion sort
+ *  on their suffixes.
+ *
+ *  This implementation makes ~ 2 n ln n character compares on average for
+ *  random strings, and uses Θ(w + log n) extra space for the recursion, where
+ *  w is the length of the longest string.
+ *  This sorting algorithm is not stable.
+ *
+ *  @author Benjamin Chan
+ *
+ *  Adapted from Algorithms, 4th edition, {@authors Robert Sedgewick and Kevin Wayne}
+ *  and their booksite https://algs4.cs.princeton.edu/
+ *
+ *  The Java program from which this C++ code was adapted from is found at
+ *  https://algs4.cs.princeton.edu/51radix/Quick3string.java.html.
+ *
+ *  @param <T> the generic type of an item in this sorting algorithm
+ */
+template<typename T> requires CharString<T>
+class Quick3string {
+public:
+    /**
+     * Rearranges the container of strings in ascending order, or descending order.
+     *
+     * @param a, the container to be sorted
+     * @param a boolean specifying whether it should be reverse
+     */
+    explicit Quick3string<T>(span<T> a, bool reverse = false) {
+        sort(a, 0, (int) a.size() - 1, 0, reverse);
+        assert(isSorted(a, reverse));
+    };
+
+private:
+    friend class MSD<T>;
+
+    // cutoff to insertion sort
+    static constexpr int CUTOFF = 15;
+
+    // the digit past the end of a string, which sorts before every character in ascending order
+    static constexpr int END = -1;
+
+    // the dth character of s, or END, mapped so that the digits always sort in ascending order
+    static inline int charAt(const T &s, int d, bool reverse) {
+        int c = d < (int) s.size() ? (unsigned char) s[d] : END;
+        return reverse ? 255 - c : c;
+    }
+
+    // the digit that charAt returns past the end of a string
+    static constexpr int endDigit(bool reverse) {
+        return reverse ? 255 - END : END;
+    }
+
+    // 3-way string quicksort a[lo..hi] starting at dth character
+    static void sort(span<T> a, int lo, int hi, int d, bool reverse);
+
+    // sort from a[lo] to a[hi], starting at the dth character
+    static void insertion(span<T> a, int lo, int hi, int d, bool reverse);
+
+    // is v less than w, starting at character d
+    static inline bool less(const T &v, const T &w, int d, bool reverse) {
+        string_view x = string_view(v).substr(d);
+        string_view y = string_view(w).substr(d);
+        return reverse ? y < x : x < y;
+    }
+
+    // check if entire container is sorted -- useful for debugging
+    static bool isSorted(span<T> a, bool reverse);
+};
+
+template<typename T>
+requires CharString<T>
+void Quick3string<T>::sort(span<T> a, int lo, int hi, int d, bool reverse) {
+    while (hi > lo + CUTOFF) {
+
+        // partition on the median of the dth characters of the first, middle and last strings
+        int mid = lo + (hi - lo) / 2;
+        int x = charAt(a[lo], d, reverse), y = charAt(a[mid], d, reverse), z = charAt(a[hi], d, reverse);
+        int m = x < y ? (y < z ? mid : x < z ? hi : lo) : (z < y ? mid : z < x ? hi : lo);
+        swap(a[lo], a[m]);
+
+        int lt = lo, gt = hi;
+        int v = charAt(a[lo], d, reverse);
+        int i = lo + 1;
+        while (i <= gt) {
+            int t = charAt(a[i], d, reverse);
+            if (t < v) swap(a[lt++], a[i++]);
+            else if (t > v) swap(a[i], a[gt--]);
+            else i++;
+        }
+
+        // a[lo..lt-1] < v = a[lt..gt] < a[gt+1..hi].
+        sort(a, lo, lt - 1, d, reverse);
+        if (v != endDigit(reverse)) sort(a, lt, gt, d + 1, reverse);
+        lo = gt + 1;
+    }
+    insertion(a, lo, hi, d, reverse);
+}
+
+template<typename T>
+requires CharString<T>
+void Quick3string<T>::insertion(span<T> a, int lo, int hi, int d, bool reverse) {
+    for (int i = lo + 1; i <= hi; i++)
+        for (int j = i; j > lo && less(a[j], a[j - 1], d, reverse); j--)
+            swap(a[j], a[j - 1]);
+}
+
+template<typename T>
+requires CharString<T>
+bool Quick3string<T>::isSorted(span<T> a, bool reverse) {
+    for (int i = 1; i < (int) a.size(); i++)
+        if (less(a[i], a[i - 1], 0, reverse)) return false;
+    return true;
+}
+
+/**
+ * Deduct the type, <T>, of the Quick3string class based on constructor argument types
+ * and number of arguments
+ */
+template<typename T> requires CharString<T>
+Quick3string(span<T>) -> Quick3string<T>;
+
+template<typename T> requires CharString<T>
+Quick3string(vector<T>) -> Quick3string<T>;
+
+template<typename T, size_t SIZE> requires CharString<T>
+Quick3string(array<T, SIZE>) -> Quick3string<T>;
+
+template<typename T> requires CharString<T>
+Quick3string(span<T>, bool reverse) -> Quick3string<T>;
+
+template<typename T> requires CharString<T>
+Quick3string(vector<T>, bool reverse) -> Quick3string<T>;
+
+template<typename T, size_t SIZE> requires CharString<T>
+Quick3string(array<T, SIZE>, bool reverse) -> Quick3string<T>;
+
+#endif //ALGORITHMS_QUICK3STRING_HPP
@@ -5,13 +5,55 @@
 #include <array>                // std::array
 #include <vector>               // std::vector
 #include "Comparable.hpp"       // includes Comparable concept used as a constraint
+#include "Partition.hpp"        // includes QuickSortMode and the partitioning routines
+#include "QuickSort.hpp"        // sorts the ranks that partialSort and nthElementRange put in order
+#include <algorithm>            // std::shuffle, std::max, std::min, std::sort, std::unique, std::lower_bound
+#include <random>               // std::random_device
+#include <cmath>                // std::log, std::exp, std::sqrt
+#include <functional>           // std::less, std::greater
 #include <cassert>              // std::assert
 #include <stdexcept>            // std::invalid_argument
 
+/// the ways {@code QuickSelect} chooses its partitioning items, besides those of {@code QuickSortMode}
+enum class QuickSelectMode {
+    // partition on a key selected from a sample, just past the rank, so that the rank falls in the smaller side
+    FloydRivest,
+    // as QuickSortMode::BlockIntrosort
+    Introselect
+};
+
 /**
  *  The {@code QuickSelect} class provides a public method for selecting the ith smallest element
  *  in an array using quicksort.
  *
+ *  By default, the container is shuffled and then partitioned on its first
+ *  item, as in the textbook. With {@code QuickSortMode::Introsort} or
+ *  {@code QuickSortMode::BlockIntrosort}, the shuffle is skipped and each
+ *  subarray is partitioned on the median of three or the ninther, with the
+ *  scanning partition or the branchless block partition of {@code QuickSort}.
+ *  These modes are introselect: a round that leaves more than 3/4 of the
+ *  subarray is a stall, and after a few stalls every partitioning item is the
+ *  median of the medians of groups of five, which leaves at most about 7/10.
+ *  Selection then takes linear time in the worst case.
+ *
+ *  {@code QuickSelectMode::FloydRivest} partitions subarrays longer than 600
+ *  on a key chosen by the algorithm of Floyd and Rivest: a sample of about
+ *  n^(2/3) / 2 evenly spaced keys is gathered around the rank, and the key
+ *  of the sample just past the rank, on the side of the nearer end, is
+ *  selected recursively. The rank then falls in the smaller side with high
+ *  probability, and about n + min(k, n - k) compares are made in expectation
+ *  to select rank k, against about 3.4 n for the median with the shuffled
+ *  mode. It falls back to the median of medians like introselect.
+ *
+ *  Several ranks are selected at once by {@code ranksOf}, which puts the
+ *  requested rank nearest the middle of the container in place, and then
+ *  recurses only into the sides that hold other requested ranks, so the
+ *  keys between two requested ranks are never ordered among themselves. The
+ *  p50, p90, p99 and p99.9 of an array take about 1.5 times the compares of
+ *  its median. {@code partialSort} and {@code nthElementRange} put the keys of
+ *  a range of ranks in place and in order, by selecting the ends of the
+ *  range and sorting between them.
+ *
  *  @author Benjamin Chan
  *
  *  Adapted from Algorithms, 4th edition, {@authors Robert Sedgewick and Kevin Wayne}
@@ -30,6 +72,17 @@ public:
         this->container = a;
     }
 
+    explicit QuickSelect<T>(span<T> a, QuickSortMode mode) {
+        this->container = a;
+        this->mode = mode;
+    }
+
+    explicit QuickSelect<T>(span<T> a, QuickSelectMode mode) {
+        this->container = a;
+        this->mode = QuickSortMode::BlockIntrosort;
+        this->sampling = mode == QuickSelectMode::FloydRivest;
+    }
+
     /**
      * Rearranges the container so that {@code a[k]} contains the kth smallest key;
      * {@code a[0]} through {@code a[k-1]} are less than (or equal to) {@code a[k]}; and
@@ -39,11 +92,87 @@ public:
      * @return the key of rank {@code k}
      * @throws IllegalArgumentException unless {@code 0 <= k < a.length}
      */
-    int rankOf(int rank, bool reverse = false);
+    T rankOf(int rank, bool reverse = false);
+
+    /**
+     * Rearranges the container so that the key of every requested rank is in
+     * place, with no greater key before it and no smaller key after it.
+     * Unlike {@code rankOf}, the container is never shuffled.
+     *
+     * @param  ranks the ranks of the keys, in any order and possibly repeated
+     * @param  reverse whether the ranks count from the largest key
+     * @return the keys of the requested ranks, in the order of {@code ranks}
+     * @throws invalid_argument unless {@code 0 <= rank < a.length} for every rank
+     */
+    vector<T> ranksOf(span<const int> ranks, bool reverse = false);
+
+    /**
+     * Rearranges the container so that {@code a[0]} through {@code a[k-1]}
+     * are its k smallest keys in ascending order (or its k largest in
+     * descending order, if reverse), and no key after them is smaller.
+     *
+     * @param  k the number of keys to put in order
+     * @param  reverse whether to put the largest keys in order
+     * @throws invalid_argument unless {@code 0 <= k <= a.length}
+     */
+    void partialSort(int k, bool reverse = false) {
+        if (k < 0 || k > (int) container.size())
+            throw invalid_argument("k is not between 0 and " + to_string(container.size()) + ": " + to_string(k));
+        if (k > 0) nthElementRange(0, k - 1, reverse);
+    }
+
+    /**
+     * Rearranges the container so that {@code a[lo]} through {@code a[hi]}
+     * hold the keys of ranks lo through hi in order, no key before them is
+     * greater, and no key after them is smaller.
+     *
+     * @param  lo the first rank of the range
+     * @param  hi the last rank of the range
+     * @param  reverse whether the ranks count from the largest key
+     * @throws invalid_argument unless {@code 0 <= lo <= hi < a.length}
+     */
+    void nthElementRange(int lo, int hi, bool reverse = false);
 
 private:
     span<T> container;
 
+    QuickSortMode mode = QuickSortMode::Shuffled;
+
+    // whether the partitioning items of long subarrays are chosen by Floyd-Rivest sampling
+    bool sampling = false;
+
+    // cutoff to insertion sort
+    static constexpr int INSERTION_SORT_CUTOFF = 16;
+
+    // cutoff from the median of three or the ninther to Floyd-Rivest sampling
+    static constexpr int SAMPLING_CUTOFF = 600;
+
+    // the number of stalls after which every partitioning item is a median of medians
+    static constexpr int STALL_LIMIT = 2;
+
+    template<typename Less>
+    T select(int rank, Less less);
+
+    // rearrange a[lo..hi], which holds the rank, so that the key of the rank is in place
+    template<typename Less>
+    void narrow(int lo, int hi, int rank, Less less);
+
+    // put the keys of the sorted, distinct ranks in a[lo..hi] in place
+    template<typename Less>
+    void multiSelect(int lo, int hi, span<const int> ranks, Less less);
+
+    // the index of a partitioning item for a[lo..hi] that is just past the rank, from a sample
+    template<typename Less>
+    int samplePivot(int lo, int hi, int rank, Less less);
+
+    // the index of the median of the medians of groups of five in a[lo..hi]
+    template<typename Less>
+    int medianOfMedians(int lo, int hi, Less less);
+
+    // sort a[lo..hi] by insertion
+    template<typename Less>
+    void insertionSort(int lo, int hi, Less less);
+
     void sort(span<T> a, int lo, int hi, bool reverse = false);
 
     int partition(span<T> a, int lo, int hi, bool reverse = false);
@@ -59,12 +188,16 @@ private:
 
 template<typename T>
 requires Comparable<T>
-int QuickSelect<T>::rankOf(int rank, bool reverse) {
+T QuickSelect<T>::rankOf(int rank, bool reverse) {
     int containerLength = this->container.size();
     if (rank < 0 || rank >= containerLength) {
         throw invalid_argument("index is not between 0 and " + to_string(containerLength) + ": " +
                                to_string(rank));
     }
+    if (mode != QuickSortMode::Shuffled) {
+        if (!reverse) return select(rank, std::less<T>());
+        else return select(rank, std::greater<T>());
+    }
     random_device rd;
     mt19937 g(rd());
     shuffle(container.begin(), container.end(), g);
@@ -78,6 +211,147 @@ int QuickSelect<T>::rankOf(int rank, bool reverse) {
     return container[lo];
 }
 
+template<typename T>
+requires Comparable<T>
+vector<T> QuickSelect<T>::ranksOf(span<const int> ranks, bool reverse) {
+    int containerLength = this->container.size();
+    for (int rank: ranks) {
+        if (rank < 0 || rank >= containerLength) {
+            throw invalid_argument("index is not between 0 and " + to_string(containerLength) + ": " +
+                                   to_string(rank));
+        }
+    }
+    vector<int> distinct(ranks.begin(), ranks.end());
+    std::sort(distinct.begin(), distinct.end());
+    distinct.erase(unique(distinct.begin(), distinct.end()), distinct.end());
+    if (!distinct.empty()) {
+        if (!reverse) multiSelect(0, containerLength - 1, distinct, std::less<T>());
+        else multiSelect(0, containerLength - 1, distinct, std::greater<T>());
+    }
+
+    vector<T> keys;
+    keys.reserve(ranks.size());
+    for (int rank: ranks) keys.push_back(container[rank]);
+    return keys;
+}
+
+template<typename T>
+requires Comparable<T>
+void QuickSelect<T>::nthElementRange(int lo, int hi, bool reverse) {
+    int containerLength = this->container.size();
+    if (lo < 0 || hi >= containerLength || lo > hi) {
+        throw invalid_argument("range is not within 0 and " + to_string(containerLength) + ": " +
+                               to_string(lo) + ", " + to_string(hi));
+    }
+    int ends[] = {lo, hi};
+    ranksOf(span<const int>(ends, lo == hi ? 1 : 2), reverse);
+    if (hi - lo > 2) QuickSort<T>{container.subspan(lo + 1, hi - lo - 1), QuickSortMode::BlockIntrosort, reverse};
+}
+
+template<typename T>
+requires Comparable<T>
+template<typename Less>
+void QuickSelect<T>::multiSelect(int lo, int hi, span<const int> ranks, Less less) {
+    while (ranks.size() > 1) {
+        // the requested rank nearest the middle splits a[lo..hi] and the other ranks most evenly
+        int mid = lo + (hi - lo) / 2;
+        int m = (int) (lower_bound(ranks.begin(), ranks.end(), mid) - ranks.begin());
+        if (m == (int) ranks.size() || (m > 0 && mid - ranks[m - 1] < ranks[m] - mid)) m--;
+        int rank = ranks[m];
+        narrow(lo, hi, rank, less);
+
+        // recurse into the smaller group of ranks, and loop on the larger one
+        span<const int> below = ranks.first(m), above = ranks.subspan(m + 1);
+        if (below.size() < above.size()) {
+            if (!below.empty()) multiSelect(lo, rank - 1, below, less);
+            lo = rank + 1;
+            ranks = above;
+        } else {
+            if (!above.empty()) multiSelect(rank + 1, hi, above, less);
+            hi = rank - 1;
+            ranks = below;
+        }
+    }
+    if (ranks.size() == 1) narrow(lo, hi, ranks[0], less);
+}
+
+template<typename T>
+requires Comparable<T>
+template<typename Less>
+T QuickSelect<T>::select(int rank, Less less) {
+    narrow(0, container.size() - 1, rank, less);
+    return container[rank];
+}
+
+template<typename T>
+requires Comparable<T>
+template<typename Less>
+void QuickSelect<T>::narrow(int lo, int hi, int rank, Less less) {
+    bool block = mode == QuickSortMode::BlockIntrosort;
+    int stalls = 0;
+    while (hi - lo + 1 > INSERTION_SORT_CUTOFF) {
+        int n = hi - lo + 1;
+        int p;
+        if (stalls > STALL_LIMIT) p = medianOfMedians(lo, hi, less);
+        else if (sampling && n > SAMPLING_CUTOFF) p = samplePivot(lo, hi, rank, less);
+        else p = medianPivot(container, lo, hi, less);
+        exch(container, lo, p);
+        int i = block ? blockPartition(container, lo, hi, less) : hoarePartition(container, lo, hi, less);
+        if (i > rank) hi = i - 1;
+        else if (i < rank) lo = i + 1;
+        else return;
+        if (4 * (hi - lo + 1) > 3 * n) stalls++;
+    }
+
+    // finish the small subarray containing the rank by insertion sort
+    insertionSort(lo, hi, less);
+}
+
+template<typename T>
+requires Comparable<T>
+template<typename Less>
+int QuickSelect<T>::samplePivot(int lo, int hi, int rank, Less less) {
+    // the sample size and the offset of its rank from that of the key, as in Floyd and Rivest (1975)
+    int n = hi - lo + 1;
+    int i = rank - lo + 1;
+    double z = log((double) n);
+    double s = 0.5 * exp(2 * z / 3);
+    double sd = 0.5 * sqrt(z * s * (n - s) / n) * (i < n / 2 ? -1 : 1);
+    int first = max(lo, (int) (rank - i * s / n + sd));
+    int last = min(hi, (int) (rank + (n - i) * s / n + sd));
+
+    // gather evenly spaced keys into a[first..last], so no shuffle is needed, and select the rank among them
+    int m = last - first + 1;
+    for (int j = 0; j < m; j++)
+        exch(container, first + j, lo + (int) ((long) j * n / m));
+    narrow(first, last, rank, less);
+    return rank;
+}
+
+template<typename T>
+requires Comparable<T>
+template<typename Less>
+int QuickSelect<T>::medianOfMedians(int lo, int hi, Less less) {
+    // move the median of every group of five to the front, and select the median of those
+    int groups = 0;
+    for (int g = lo; g + 4 <= hi; g += 5) {
+        insertionSort(g, g + 4, less);
+        exch(container, lo + groups++, g + 2);
+    }
+    int median = lo + (groups - 1) / 2;
+    narrow(lo, lo + groups - 1, median, less);
+    return median;
+}
+
+template<typename T>
+requires Comparable<T>
+template<typename Less>
+void QuickSelect<T>::insertionSort(int lo, int hi, Less less) {
+    for (int i = lo + 1; i <= hi; i++)
+        for (int j = i; j > lo && less(container[j], container[j - 1]); j--)
+            exch(container, j, j - 1);
+}
+
 template<typename T>
 requires Comparable<T>
 void QuickSelect<T>::sort(span<T> a, int lo, int hi, bool reverse) {
@@ -195,4 +469,22 @@ QuickSelect(array<T, SIZE>, bool reverse) -> QuickSelect<T>;
 template<typename T> requires Comparable<T>
 QuickSelect(T a[], int length, bool reverse) -> QuickSelect<T>;
 
+template<typename T> requires Comparable<T>
+QuickSelect(span<T>, QuickSortMode mode) -> QuickSelect<T>;
+
+template<typename T> requires Comparable<T>
+QuickSelect(vector<T>, QuickSortMode mode) -> QuickSelect<T>;
+
+template<typename T, size_t SIZE> requires Comparable<T>
+QuickSelect(array<T, SIZE>, QuickSortMode mode) -> QuickSelect<T>;
+
+template<typename T> requires Comparable<T>
+QuickSelect(span<T>, QuickSelectMode mode) -> QuickSelect<T>;
+
+template<typename T> requires Comparable<T>
+QuickSelect(vector<T>, QuickSelectMode mode) -> QuickSelect<T>;
+
+template<typename T, size_t SIZE> requires Comparable<T>
+QuickSelect(array<T, SIZE>, QuickSelectMode mode) -> QuickSelect<T>;
+
 #endif //ALGORITHMS_QUICKSELECT_HPP
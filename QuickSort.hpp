@@ -5,8 +5,11 @@
 #include <array>                // std::array
 #include <vector>               // std::vector
 #include "Comparable.hpp"       // includes Comparable concept used as a constraint
+#include "Partition.hpp"        // includes QuickSortMode and the partitioning routines
 #include <algorithm>            // std::shuffle
 #include <random>               // std::random_device
+#include <functional>           // std::less, std::greater
+#include <bit>                  // std::bit_width
 #include <cassert>              // std::assert
 
 using namespace std;
@@ -15,6 +18,18 @@ using namespace std;
  *  The {@code QuickSort} class provides a public method for sorting a
  *  container.
  *
+ *  By default, the container is shuffled and then partitioned on its first
+ *  item, as in the textbook. In {@code QuickSortMode::Introsort} the shuffle is
+ *  skipped: each partitioning item is the median of three items, or Tukey's
+ *  ninther (the median of three medians of three) for subarrays longer than 40,
+ *  subarrays of at most 16 items are finished by insertion sort, and a
+ *  subarray that is still being partitioned after 2 lg n levels is finished by
+ *  heapsort. The sort then takes Θ(n log n) time in the worst case, and only
+ *  Θ(log n) extra space since the recursion is on the smaller side.
+ *  {@code QuickSortMode::BlockIntrosort} is the same, except that it partitions
+ *  with the branchless block partition of BlockQuicksort, which avoids the
+ *  branch mispredictions of the scanning loops on random keys.
+ *
  *  @author Benjamin Chan
  *
  *  Adapted from Algorithms, 4th edition, {@authors Robert Sedgewick and Kevin Wayne}
@@ -37,13 +52,43 @@ public:
         assert(isSorted(a, reverse));
     };
 
+    explicit QuickSort<T>(span<T> a, QuickSortMode mode, bool reverse = false) {
+        if (mode == QuickSortMode::Shuffled) {
+            random_device rd;
+            mt19937 g(rd());
+            shuffle(a.begin(), a.end(), g);
+            sort(a, 0, a.size() - 1, reverse);
+        } else if (a.size() > 1) {
+            int depth = 2 * ((int) bit_width(a.size()) - 1);
+            bool block = mode == QuickSortMode::BlockIntrosort;
+            if (!reverse) introsort(a, 0, a.size() - 1, depth, block, std::less<T>());
+            else introsort(a, 0, a.size() - 1, depth, block, std::greater<T>());
+        }
+        assert(isSorted(a, reverse));
+    };
+
 private:
+    // cutoff to insertion sort
+    static constexpr int INSERTION_SORT_CUTOFF = 16;
+
     void sort(span<T> a, int lo, int hi, bool reverse = false);
 
     int partition(span<T> a, int lo, int hi, bool reverse = false);
 
     void exch(span<T> a, int i, int j);
 
+    template<typename Less>
+    void introsort(span<T> a, int lo, int hi, int depth, bool block, Less less);
+
+    template<typename Less>
+    void insertionSort(span<T> a, int lo, int hi, Less less);
+
+    template<typename Less>
+    void heapSort(span<T> a, int lo, int hi, Less less);
+
+    template<typename Less>
+    void sink(span<T> a, int lo, int k, int n, Less less);
+
     // check if entire container is sorted -- useful for debugging
     bool isSorted(span<T> a, int lo, int hi, bool reverse = false);
 
@@ -111,6 +156,70 @@ int QuickSort<T>::partition(span<T> a, int lo, int hi, bool reverse) {
     return j;
 }
 
+template<typename T>
+requires Comparable<T>
+template<typename Less>
+void QuickSort<T>::introsort(span<T> a, int lo, int hi, int depth, bool block, Less less) {
+    while (hi - lo + 1 > INSERTION_SORT_CUTOFF) {
+        if (depth-- == 0) {
+            heapSort(a, lo, hi, less);
+            return;
+        }
+        exch(a, lo, medianPivot(a, lo, hi, less));
+        int j = block ? blockPartition(a, lo, hi, less) : hoarePartition(a, lo, hi, less);
+
+        // recur on the smaller subarray and loop on the larger one
+        if (j - lo < hi - j) {
+            introsort(a, lo, j - 1, depth, block, less);
+            lo = j + 1;
+        } else {
+            introsort(a, j + 1, hi, depth, block, less);
+            hi = j - 1;
+        }
+    }
+    insertionSort(a, lo, hi, less);
+}
+
+template<typename T>
+requires Comparable<T>
+template<typename Less>
+void QuickSort<T>::insertionSort(span<T> a, int lo, int hi, Less less) {
+    for (int i = lo + 1; i <= hi; i++) {
+        T v = std::move(a[i]);
+        int j = i;
+        for (; j > lo && less(v, a[j - 1]); j--)
+            a[j] = std::move(a[j - 1]);
+        a[j] = std::move(v);
+    }
+}
+
+// heapsort a[lo..hi], numbering the heap from 1 as in the textbook
+template<typename T>
+requires Comparable<T>
+template<typename Less>
+void QuickSort<T>::heapSort(span<T> a, int lo, int hi, Less less) {
+    int n = hi - lo + 1;
+    for (int k = n / 2; k >= 1; k--)
+        sink(a, lo, k, n, less);
+    while (n > 1) {
+        exch(a, lo, lo + n - 1);
+        sink(a, lo, 1, --n, less);
+    }
+}
+
+template<typename T>
+requires Comparable<T>
+template<typename Less>
+void QuickSort<T>::sink(span<T> a, int lo, int k, int n, Less less) {
+    while (2 * k <= n) {
+        int j = 2 * k;
+        if (j < n && less(a[lo + j - 1], a[lo + j])) j++;
+        if (!less(a[lo + k - 1], a[lo + j - 1])) break;
+        exch(a, lo + k - 1, lo + j - 1);
+        k = j;
+    }
+}
+
 template<typename T>
 requires Comparable<T>
 void QuickSort<T>::exch(span<T> a, int i, int j) {
@@ -168,4 +277,22 @@ QuickSort(array<T, SIZE>, bool reverse) -> QuickSort<T>;
 template<typename T> requires Comparable<T>
 QuickSort(T a[], int length, bool reverse) -> QuickSort<T>;
 
+template<typename T> requires Comparable<T>
+QuickSort(span<T>, QuickSortMode mode) -> QuickSort<T>;
+
+template<typename T> requires Comparable<T>
+QuickSort(vector<T>, QuickSortMode mode) -> QuickSort<T>;
+
+template<typename T, size_t SIZE> requires Comparable<T>
+QuickSort(array<T, SIZE>, QuickSortMode mode) -> QuickSort<T>;
+
+template<typename T> requires Comparable<T>
+QuickSort(span<T>, QuickSortMode mode, bool reverse) -> QuickSort<T>;
+
+template<typename T> requires Comparable<T>
+QuickSort(vector<T>, QuickSortMode mode, bool reverse) -> QuickSort<T>;
+
+template<typename T, size_t SIZE> requires Comparable<T>
+QuickSort(array<T, SIZE>, QuickSortMode mode, bool reverse) -> QuickSort<T>;
+
 #endif //ALGORITHMS_QUICKSORT_HPP
@@ -0,0 +1,218 @@
+#ifndef ALGORITHMS_RADIXHEAP_HPP
+#define ALGORITHMS_RADIXHEAP_HPP
+
+#include <string>                   // std::string, std::to_string
+#include <sstream>                  // std::stringstream
+#include <vector>                   // std::vector
+#include <array>                    // std::array
+#include <algorithm>                // std::sort
+#include <functional>               // std::identity, std::invoke
+#include <concepts>                 // std::unsigned_integral
+#include <type_traits>              // std::invoke_result_t, std::remove_cvref_t
+#include <bit>                      // std::bit_width
+#include <limits>                   // std::numeric_limits
+#include <exception>                // std::exception
+#include <stdexcept>                // std::invalid_argument
+#include <utility>                  // std::move
+#include <boost/lexical_cast.hpp>   // boost::lexical_cast
+
+using namespace std;
+
+/**
+ *  The {@code RadixHeap} class represents a monotone priority queue of items
+ *  with unsigned integer keys: no item may be inserted with a key smaller than
+ *  the last key deleted. It supports the insert, delete-the-minimum and min
+ *  operations of {@code MinPQ}. This is the access pattern of Dijkstra's
+ *  algorithm and of event simulations, in which the items inserted are never
+ *  earlier than the one being processed.
+ *
+ *  This implementation keeps w + 1 buckets for keys of w bits. Bucket 0 holds
+ *  the items whose key equals the last key deleted, and bucket i the items
+ *  whose key first differs from it at bit i - 1, counting from the lowest bit.
+ *  When bucket 0 runs out, the first bucket that is not empty is emptied: its
+ *  smallest key becomes the last key, and its items are put back into buckets
+ *  that are all lower than the one they came from. An item therefore moves at
+ *  most w times, and the buckets are plain arrays scanned in order, with no
+ *  compares between keys of different buckets.
+ *
+ *  The insert, size and is-empty operations take Θ(1) time in the worst case,
+ *  and the delete-the-minimum operation takes Θ(w) amortized time, which is
+ *  constant for a fixed key width. The min operation scans the first bucket
+ *  that is not empty, without moving any item, and remembers where the
+ *  smallest item is until the next deletion empties that bucket; the deletion
+ *  scans the same bucket, so min takes Θ(1) amortized time.
+ *
+ *  @author Benjamin Chan
+ *
+ *  @param <T> the type of an item on this priority queue
+ *  @param <KeyOf> the function object that returns the unsigned key of an item
+ */
+template<typename T, typename KeyOf = identity>
+requires unsigned_integral<remove_cvref_t<invoke_result_t<KeyOf, const T &>>>
+class RadixHeap {
+public:
+    /// the type of a key
+    using Key = remove_cvref_t<invoke_result_t<KeyOf, const T &>>;
+
+    /// Initializes an empty priority queue
+    explicit RadixHeap(KeyOf keyOf = KeyOf()) : keyOf(keyOf) {};
+
+    /**
+     * Returns true if this priority queue is empty.
+     *
+     * @return {@code true} if this priority queue is empty;
+     *         {@code false} otherwise
+     */
+    bool isEmpty() const {
+        return n == 0;
+    }
+
+    /**
+     * Returns the number of items on this priority queue.
+     *
+     * @return the number of items on this priority queue
+     */
+    int size() const {
+        return n;
+    }
+
+    /**
+     * Returns an item with the smallest key on this priority queue.
+     *
+     * @return an item with the smallest key on this priority queue
+     * @throws NoSuchElementException if this priority queue is empty
+     */
+    const T &min() const {
+        if (isEmpty()) throw NoSuchElementException();
+        if (!buckets[0].empty()) return buckets[0].back();
+
+        // peeking does not delete, so the last key stays; the smallest item of the first nonempty bucket is the min
+        if (minBucket == 0) {
+            int i = 1;
+            while (buckets[i].empty()) i++;
+            size_t min = 0;
+            for (size_t j = 1; j < buckets[i].size(); j++)
+                if (invoke(keyOf, buckets[i][j]) < invoke(keyOf, buckets[i][min])) min = j;
+            minBucket = i;
+            minIndex = min;
+        }
+        return buckets[minBucket][minIndex];
+    }
+
+    /**
+     * Adds a new item to this priority queue.
+     *
+     * @param  x the new item to add to this priority queue
+     * @throws invalid_argument if the key of {@code x} is smaller than the last key deleted
+     */
+    void insert(T x) {
+        Key key = invoke(keyOf, x);
+        if (key < last)
+            throw invalid_argument("key " + to_string(key) + " is smaller than the last key deleted, "
+                                   + to_string(last));
+        int bucket = bucketOf(key);
+        buckets[bucket].push_back(std::move(x));
+        n++;
+        if (minBucket != 0 && bucket != 0 && key < invoke(keyOf, buckets[minBucket][minIndex])) {
+            minBucket = bucket;
+            minIndex = buckets[bucket].size() - 1;
+        }
+    }
+
+    /**
+     * Removes and returns an item with the smallest key on this priority queue.
+     *
+     * @return an item with the smallest key on this priority queue
+     * @throws NoSuchElementException if this priority queue is empty
+     */
+    T delMin() {
+        if (isEmpty()) throw NoSuchElementException();
+        pull();
+        T min = std::move(buckets[0].back());
+        buckets[0].pop_back();
+        n--;
+        return min;
+    }
+
+    /**
+     * Returns the last key deleted, the smallest key that may still be inserted.
+     *
+     * @return the last key deleted, or 0 if none has been
+     */
+    Key lastKey() const {
+        return last;
+    }
+
+    /**
+      * Returns a string representation of this priority queue.
+      *
+      * @return the sequence of keys in ascending order, separated by spaces
+      */
+    [[nodiscard]] std::string toString() const;
+
+    /**
+     * @def the NoSuchElementException if there are no items in the priority queue
+     */
+    struct NoSuchElementException : public std::exception {
+        [[nodiscard]] const char *what() const noexcept override {
+            return "Priority Queue Underflow";
+        }
+    };
+
+private:
+    // the number of bits of a key
+    static constexpr int BITS = numeric_limits<Key>::digits;
+
+    KeyOf keyOf;                                // returns the key of an item
+    array<vector<T>, BITS + 1> buckets;         // buckets[i] holds the keys that first differ from last at bit i - 1
+    Key last = 0;                               // the last key deleted
+    int n = 0;                                  // number of items on priority queue
+    mutable int minBucket = 0;                  // the bucket of the smallest item found by min(), or 0 if unknown
+    mutable size_t minIndex = 0;                // the index of that item in its bucket
+
+    // the bucket of a key, given the last key deleted
+    int bucketOf(Key key) const {
+        return bit_width(static_cast<Key>(key ^ last));
+    }
+
+    // make bucket 0 hold the items with the smallest key, if it is empty
+    void pull() {
+        if (!buckets[0].empty()) return;
+        int i = 1;
+        while (buckets[i].empty()) i++;
+
+        // the smallest key of the bucket becomes the last key, and every item of it moves to a lower bucket
+        Key min = invoke(keyOf, buckets[i][0]);
+        for (const T &x: buckets[i]) {
+            Key key = invoke(keyOf, x);
+            if (key < min) min = key;
+        }
+        last = min;
+        for (T &x: buckets[i])
+            buckets[bucketOf(invoke(keyOf, x))].push_back(std::move(x));
+        buckets[i].clear();
+        minBucket = 0;
+    }
+};
+
+template<typename T, typename KeyOf>
+requires unsigned_integral<remove_cvref_t<invoke_result_t<KeyOf, const T &>>>
+std::string RadixHeap<T, KeyOf>::toString() const {
+    vector<Key> keys;
+    for (const auto &bucket: buckets)
+        for (const T &x: bucket) keys.push_back(invoke(keyOf, x));
+    sort(keys.begin(), keys.end());
+    std::stringstream ss;
+    for (Key key: keys)
+        ss << boost::lexical_cast<std::string>(key) << " ";
+    ss << endl;
+    return ss.str();
+}
+
+/// Overloads the "<<" operator for a radix heap
+template<typename T, typename KeyOf>
+std::ostream &operator<<(std::ostream &os, const RadixHeap<T, KeyOf> &radixHeap) {
+    return os << radixHeap.toString();
+}
+
+#endif //ALGORITHMS_RADIXHEAP_HPP
@@ -0,0 +1,335 @@
+#ifndef ALGORITHMS_RESIZINGARRAYQUEUE_HPP
+#define ALGORITHMS_RESIZINGARRAYQUEUE_HPP
+
+#include <string>                   // std::string
+#include <sstream>                  // std::stringstream
+#include <iostream>                 // std::cout
+#include <exception>                // std::exception
+#include <cassert>                  // std::assert
+#include <vector>                   // std::vector
+#include <span>                     // std::span
+#include <cstring>                  // std::memcpy
+#include <algorithm>                // std::copy, std::min
+#include <type_traits>              // std::is_trivially_copyable_v
+#include <boost/lexical_cast.hpp>   // boost::lexical_cast
+
+/**
+ *  The {@code ResizingArrayQueue} class represents a first-in-first-out (FIFO)
+ *  queue of generic items.
+ *  It supports the usual enqueue and dequeue
+ *  operations, along with methods for peeking at the first item,
+ *  testing if the queue is empty, and iterating through
+ *  the items in FIFO order. It also supports enqueueing and dequeueing
+ *  whole runs of items at once.
+ *
+ *  This implementation uses a circular buffer whose capacity is a power of
+ *  two, so that wrapping an index around is a bitwise and. The buffer doubles
+ *  when it is full. Items are stored contiguously, so a dequeue never follows
+ *  a pointer, and bulk operations copy at most two contiguous runs (with
+ *  memcpy if {@code T} is trivially copyable).
+ *  The enqueue operation takes Θ(1) amortized time, and the dequeue, peek,
+ *  size and is-empty operations take Θ(1) time in the worst case.
+ *  The bulk operations take time proportional to the number of items copied.
+ *
+ *  @author Benjamin Chan
+ *
+ *  Adapted from Algorithms, 4th edition, {@authors Robert Sedgewick and Kevin Wayne}
+ *  and their booksite https://algs4.cs.princeton.edu/
+ *
+ *  The Java program from which this C++ code was adapted from is found at
+ *  https://algs4.cs.princeton.edu/13stacks/ResizingArrayQueue.java.html.
+ *
+ *  @param <T> the generic type of an item in this queue
+ */
+template<typename T>
+class ResizingArrayQueue {
+private:
+    /**
+     * @def the NoSuchElementException if there are no items in a queue after
+     * using the dequeue() and peek() methods
+     */
+    struct NoSuchElementException : public std::exception {
+        const char *what() {
+            return "Queue Underflow";
+        }
+    };
+
+public:
+    /// Initializes an empty queue
+    ResizingArrayQueue() : q(INIT_CAPACITY), n(0), first(0) {};
+
+    /// Prevents the invocation of the constructor with an lvalue queue
+    ResizingArrayQueue(const ResizingArrayQueue<T> &other) = delete;
+
+    /// Prevents the invocation of the constructor with an rvalue queue
+    ResizingArrayQueue(ResizingArrayQueue<T> &&other) = delete;
+
+    /**
+     * Returns true if this queue is empty.
+     *
+     * @return {@code true} if this queue is empty; {@code false} otherwise
+     */
+    inline bool isEmpty() {
+        return n == 0;
+    };
+
+    /**
+     * Returns the number of items in this queue.
+     *
+     * @return the number of items in this queue
+     */
+    inline int size() {
+        return n;
+    }
+
+    /**
+     * Returns the item least recently added to this queue.
+     *
+     * @return the item least recently added to this queue
+     * @throws NoSuchElementException if this queue is empty
+     */
+    T peek();
+
+    /**
+     * Adds the item to this queue.
+     *
+     * @param  item the item to add
+     */
+    void enqueue(T item);
+
+    /**
+     * Removes and returns the item on this queue that was least recently added.
+     *
+     * @return the item on this queue that was least recently added
+     * @throws NoSuchElementException if this queue is empty
+     */
+    T dequeue();
+
+    /**
+     * Adds the items to this queue, in order.
+     *
+     * @param  items the items to add
+     */
+    void enqueueBulk(std::span<const T> items);
+
+    /**
+     * Removes the items least recently added to this queue, in order, until
+     * either {@code out} is full or this queue is empty.
+     *
+     * @param  out the container receiving the items
+     * @return the number of items removed
+     */
+    int dequeueBulk(std::span<T> out);
+
+    /**
+     * Returns a string representation of this queue.
+     *
+     * @return the sequence of items in FIFO order, separated by spaces
+     */
+    [[nodiscard]] std::string toString() const;
+
+    /// Nested iterator class
+    class Iterator {
+        friend class ResizingArrayQueue<T>;
+
+    private:
+        const ResizingArrayQueue<T> *queuePtr;
+        int i;
+
+        // The constructor is private, so only our friends
+        // can create instances of iterators.
+        Iterator(const ResizingArrayQueue<T> *queuePtr, int i) : queuePtr(queuePtr), i(i) {};
+
+    public:
+        Iterator() : queuePtr(nullptr), i(0) {}
+
+        // Overload for the comparison operator !=
+        inline bool operator!=(const Iterator &itr) const {
+            return i != itr.i;
+        }
+
+        // Overload for the dereference operator *
+        inline const T &operator*() const {
+            return queuePtr->q[(queuePtr->first + i) & (queuePtr->q.size() - 1)];
+        }
+
+        // Overload for the preincrement operator ++
+        inline Iterator &operator++() {
+            i++;
+            return *this;
+        }
+
+        // Overload for the postincrement operator ++
+        inline Iterator operator++(int) {
+            Iterator temp(*this);
+            operator++();
+            return temp;
+        }
+    }; // End of inner class iterator
+
+    /**
+     * Returns an iterator that points to the first item of the queue.
+     *
+     * @return an iterator that points to the first item of the queue
+     */
+    inline Iterator begin() const {
+        return Iterator(this, 0);
+    }
+
+    /**
+     * Returns an iterator that points past the last item of the queue.
+     *
+     * @return an iterator that points past the last item of the queue
+     */
+    inline Iterator end() const {
+        return Iterator(this, n);
+    }
+
+private:
+    /// the initial capacity of a queue, a power of two
+    static constexpr int INIT_CAPACITY = 8;
+
+    /// the circular buffer, whose size is a power of two
+    std::vector<T> q;
+
+    /// the number of items in a queue
+    int n;
+
+    /// the index of the first item in a queue
+    int first;
+
+    /// the index mask of the circular buffer
+    inline int mask() const {
+        return (int) q.size() - 1;
+    }
+
+    /// resizes the circular buffer to the given power-of-two capacity
+    void resize(int capacity);
+
+    /// grows the circular buffer so that it can hold at least the given number of items
+    void reserve(int capacity);
+
+    /// copies a contiguous run of items
+    static void copyRun(const T *from, T *to, int count);
+};
+
+template<typename T>
+T ResizingArrayQueue<T>::peek() {
+    try {
+        if (isEmpty()) throw NoSuchElementException();
+        return q[first];
+    }
+    catch (NoSuchElementException &e) {
+        std::cout << "NoSuchElementException encountered: ";
+        std::cout << e.what() << std::endl;
+        return T();
+    }
+}
+
+template<typename T>
+void ResizingArrayQueue<T>::enqueue(T item) {
+    // double size of the circular buffer if necessary
+    if (n == (int) q.size()) resize(2 * n);
+    q[(first + n) & mask()] = std::move(item);
+    n++;
+}
+
+template<typename T>
+T ResizingArrayQueue<T>::dequeue() {
+    try {
+        if (isEmpty()) throw NoSuchElementException();
+        T item = std::move(q[first]);
+        if constexpr (!std::is_trivially_copyable_v<T>)
+            q[first] = T();             // to avoid loitering
+        first = (first + 1) & mask();
+        n--;
+        return item;
+    }
+    catch (NoSuchElementException &e) {
+        std::cout << "NoSuchElementException encountered: ";
+        std::cout << e.what() << std::endl;
+        return T();
+    }
+}
+
+template<typename T>
+void ResizingArrayQueue<T>::enqueueBulk(std::span<const T> items) {
+    int count = items.size();
+    reserve(n + count);
+
+    // the free slots are at most two runs: up to the end of the buffer, then from its start
+    int last = (first + n) & mask();
+    int tail = std::min(count, (int) q.size() - last);
+    copyRun(items.data(), q.data() + last, tail);
+    copyRun(items.data() + tail, q.data(), count - tail);
+    n += count;
+}
+
+template<typename T>
+int ResizingArrayQueue<T>::dequeueBulk(std::span<T> out) {
+    int count = std::min((int) out.size(), n);
+
+    if constexpr (std::is_trivially_copyable_v<T>) {
+        // the items are at most two runs: up to the end of the buffer, then from its start
+        int head = std::min(count, (int) q.size() - first);
+        copyRun(q.data() + first, out.data(), head);
+        copyRun(q.data(), out.data() + head, count - head);
+    } else {
+        for (int i = 0; i < count; i++) {
+            T &item = q[(first + i) & mask()];
+            out[i] = std::move(item);
+            item = T();                 // to avoid loitering
+        }
+    }
+    first = (first + count) & mask();
+    n -= count;
+    return count;
+}
+
+template<typename T>
+void ResizingArrayQueue<T>::resize(int capacity) {
+    assert(capacity >= n && (capacity & (capacity - 1)) == 0);
+    std::vector<T> copy(capacity);
+    int head = std::min(n, (int) q.size() - first);
+    for (int i = 0; i < head; i++)
+        copy[i] = std::move(q[first + i]);
+    for (int i = head; i < n; i++)
+        copy[i] = std::move(q[i - head]);
+    q = std::move(copy);
+    first = 0;
+}
+
+template<typename T>
+void ResizingArrayQueue<T>::reserve(int capacity) {
+    int size = q.size();
+    if (capacity <= size) return;
+    while (size < capacity) size *= 2;
+    resize(size);
+}
+
+template<typename T>
+void ResizingArrayQueue<T>::copyRun(const T *from, T *to, int count) {
+    if (count <= 0) return;
+    if constexpr (std::is_trivially_copyable_v<T>)
+        std::memcpy(to, from, count * sizeof(T));
+    else
+        std::copy(from, from + count, to);
+}
+
+template<typename T>
+std::string ResizingArrayQueue<T>::toString() const {
+    std::stringstream ss;
+    for (const auto &item: *this) {
+        ss << boost::lexical_cast<std::string>(item) << " ";
+    }
+    ss << std::endl;
+    return ss.str();
+}
+
+/// Overloads the "<<" operator for a queue
+template<typename T>
+std::ostream &operator<<(std::ostream &os, const ResizingArrayQueue<T> &queue) {
+    return os << queue.toString();
+}
+
+#endif //ALGORITHMS_RESIZINGARRAYQUEUE_HPP
@@ -5,6 +5,7 @@
 #include <sstream>                  // std::stringstream
 #include <iostream>                 // std::cout
 #include <exception>                // std::exception
+#include <memory>                   // std::allocator, std::allocator_traits
 #include <boost/lexical_cast.hpp>   // boost::lexical_cast
 
 /**
@@ -14,6 +15,9 @@
  *  the items in LIFO order.
  *
  *  This implementation uses a singly linked list with a nested class Node.
+ *  Nodes are obtained from the allocator parameter, rebound to the node type;
+ *  use {@code PoolAllocator} to draw them from contiguous recycled chunks
+ *  instead of a heap allocation per item.
  *
  *  @author Benjamin Chan
  *
@@ -24,8 +28,9 @@
  *  https://algs4.cs.princeton.edu/13stacks/Stack.java.html.
  *
  *  @param <T> the generic type of an item in this stack
+ *  @param <Allocator> the allocator from which nodes are obtained
  */
-template<typename T>
+template<typename T, typename Allocator = std::allocator<T>>
 class Stack {
 private:
     /**
@@ -47,20 +52,22 @@ public:
     /// Initializes an empty stack
     Stack() : n(0), first(nullptr), last(nullptr) {};
 
+    /// Initializes an empty stack whose nodes are obtained from the given allocator
+    explicit Stack(const Allocator &alloc) : n(0), first(nullptr), last(nullptr), nodeAllocator(alloc) {};
+
     /// Prevents the invocation of the constructor with an lvalue stack
-    Stack(const Stack<T> &other) = delete;
+    Stack(const Stack<T, Allocator> &other) = delete;
 
     /// Prevents the invocation of the constructor with an rvalue stack
-    Stack(Stack<T> &&other) = delete;
+    Stack(Stack<T, Allocator> &&other) = delete;
 
     /// Destructor deletes all allocated items of a stack
     ~Stack() {
-        while (first->next != nullptr) {
+        while (first != nullptr) {
             Node *temp = first;
             first = first->next;
-            delete temp;
+            destroyNode(temp);
         }
-        delete first;
     };
 
     /**
@@ -113,7 +120,7 @@ public:
 
     /// Nested iterator class
     class Iterator {
-        friend class Stack<T>;
+        friend class Stack<T, Allocator>;
 
     private:
         Node *nodePtr;
@@ -154,7 +161,7 @@ public:
     }
 
     inline Iterator end() const {
-        return Iterator(last->next);
+        return Iterator(nullptr);
     }
 
 private:
@@ -180,11 +187,31 @@ private:
     /// the last node of a stack
     Node *last;
 
+    /// the allocator rebound to the node type
+    using NodeAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+    using NodeTraits = std::allocator_traits<NodeAllocator>;
+
+    /// the allocator from which nodes are obtained
+    NodeAllocator nodeAllocator;
+
+    /// allocates and constructs a node
+    template<typename... Args>
+    Node *createNode(Args &&... args) {
+        Node *node = NodeTraits::allocate(nodeAllocator, 1);
+        return ::new(static_cast<void *>(node)) Node(std::forward<Args>(args)...);
+    }
+
+    /// destroys and deallocates a node
+    void destroyNode(Node *node) {
+        node->~Node();
+        NodeTraits::deallocate(nodeAllocator, node, 1);
+    }
+
 };
 
 
-template<typename T>
-T Stack<T>::peek() {
+template<typename T, typename Allocator>
+T Stack<T, Allocator>::peek() {
     try {
         if (isEmpty()) throw NoSuchElementException();
         return this->first.item;
@@ -195,28 +222,28 @@ T Stack<T>::peek() {
     }
 }
 
-template<typename T>
-void Stack<T>::push(T item) {
+template<typename T, typename Allocator>
+void Stack<T, Allocator>::push(T item) {
     if (isEmpty()) {
-        last = new Node();
+        last = createNode();
         first = last;
         first->item = item;
         n++;
         return;
     }
     Node *oldFirst = first;
-    first = new Node(item, oldFirst);
+    first = createNode(item, oldFirst);
     n++;
 }
 
-template<typename T>
-T Stack<T>::pop() {
+template<typename T, typename Allocator>
+T Stack<T, Allocator>::pop() {
     try {
         if (isEmpty()) throw NoSuchElementException();
         Node *oldFirst = first;
         T item = first->item;
         first = first->next;
-        delete oldFirst;
+        destroyNode(oldFirst);
         n--;
         return item;
     }
@@ -227,8 +254,8 @@ T Stack<T>::pop() {
     }
 }
 
-template<typename T>
-std::string Stack<T>::toString() const {
+template<typename T, typename Allocator>
+std::string Stack<T, Allocator>::toString() const {
     std::stringstream ss;
     for (const auto &item: *this) {
         ss << boost::lexical_cast<std::string>(item) << " ";
@@ -238,8 +265,8 @@ std::string Stack<T>::toString() const {
 }
 
 /// Overloads the "<<" operator for a stack
-template<typename T>
-std::ostream &operator<<(std::ostream &os, const Stack<T> &stack) {
+template<typename T, typename Allocator>
+std::ostream &operator<<(std::ostream &os, const Stack<T, Allocator> &stack) {
     return os << stack.toString();
 }
 
@@ -0,0 +1,93 @@
+#include "ThreadPool.hpp"
+
+namespace {
+    // the pool and queue index of the calling worker thread, if any
+    thread_local ThreadPool *currentPool = nullptr;
+    thread_local unsigned int currentQueue = 0;
+}
+
+ThreadPool::ThreadPool(unsigned int threads) : pending(0), done(false) {
+    if (threads == 0) threads = 1;
+    for (unsigned int i = 0; i <= threads; i++)
+        queues.push_back(make_unique<WorkQueue>());
+    for (unsigned int i = 0; i < threads; i++)
+        workers.emplace_back(&ThreadPool::workerLoop, this, i);
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        lock_guard<mutex> lk(sleepLock);
+        done = true;
+    }
+    wakeUp.notify_all();
+    for (auto &worker: workers)
+        worker.join();
+}
+
+unsigned int ThreadPool::ownQueue() {
+    return currentPool == this ? currentQueue : queues.size() - 1;
+}
+
+void ThreadPool::submit(function<void()> task) {
+    WorkQueue &q = *queues[ownQueue()];
+    {
+        lock_guard<mutex> lk(q.lock);
+        q.tasks.push_back(move(task));
+    }
+    pending.fetch_add(1, memory_order_release);
+
+    // taking the sleep lock orders this wake-up after a worker's last check of pending
+    { lock_guard<mutex> lk(sleepLock); }
+    wakeUp.notify_one();
+}
+
+bool ThreadPool::take(unsigned int i, function<void()> &task) {
+    // pop the most recently pushed task of our own queue
+    {
+        WorkQueue &q = *queues[i];
+        lock_guard<mutex> lk(q.lock);
+        if (!q.tasks.empty()) {
+            task = move(q.tasks.back());
+            q.tasks.pop_back();
+            pending.fetch_sub(1, memory_order_relaxed);
+            return true;
+        }
+    }
+
+    // steal the oldest task of some other queue
+    unsigned int n = queues.size();
+    for (unsigned int k = 1; k < n; k++) {
+        WorkQueue &q = *queues[(i + k) % n];
+        lock_guard<mutex> lk(q.lock);
+        if (!q.tasks.empty()) {
+            task = move(q.tasks.front());
+            q.tasks.pop_front();
+            pending.fetch_sub(1, memory_order_relaxed);
+            return true;
+        }
+    }
+    return false;
+}
+
+bool ThreadPool::tryRunPending() {
+    if (pending.load(memory_order_acquire) == 0) return false;
+    function<void()> task;
+    if (!take(ownQueue(), task)) return false;
+    task();
+    return true;
+}
+
+void ThreadPool::workerLoop(unsigned int i) {
+    currentPool = this;
+    currentQueue = i;
+    while (true) {
+        function<void()> task;
+        if (take(i, task)) {
+            task();
+            continue;
+        }
+        unique_lock<mutex> lk(sleepLock);
+        wakeUp.wait(lk, [this] { return done || pending.load(memory_order_acquire) > 0; });
+        if (done) return;
+    }
+}
@@ -0,0 +1,152 @@
+#ifndef ALGORITHMS_THREADPOOL_HPP
+#define ALGORITHMS_THREADPOOL_HPP
+
+#include <atomic>                   // std::atomic
+#include <condition_variable>       // std::condition_variable
+#include <deque>                    // std::deque
+#include <functional>               // std::function
+#include <memory>                   // std::unique_ptr
+#include <mutex>                    // std::mutex
+#include <thread>                   // std::thread
+#include <vector>                   // std::vector
+
+using namespace std;
+
+/**
+ *  The {@code ThreadPool} class represents a fixed set of worker threads that
+ *  execute submitted tasks using work stealing.
+ *
+ *  Every worker owns a deque of tasks. A worker pushes and pops tasks at the
+ *  back of its own deque (LIFO, so recently split work stays in cache) and,
+ *  when its deque is empty, steals from the front of another worker's deque
+ *  (FIFO, so thieves take the largest outstanding pieces of work). Threads
+ *  that are not part of the pool submit into a shared injection deque.
+ *
+ *  Fork-join algorithms should use a {@code TaskGroup}: waiting on a group
+ *  runs pending tasks instead of blocking, so nested parallelism never
+ *  deadlocks the pool.
+ *
+ *  @author Benjamin Chan
+ */
+class ThreadPool {
+public:
+    /**
+     * Starts a pool with the given number of worker threads.
+     *
+     * @param threads the number of worker threads (at least 1)
+     */
+    explicit ThreadPool(unsigned int threads = thread::hardware_concurrency());
+
+    /// Prevents the invocation of the constructor with an lvalue pool
+    ThreadPool(const ThreadPool &other) = delete;
+
+    /// Prevents the invocation of the constructor with an rvalue pool
+    ThreadPool(ThreadPool &&other) = delete;
+
+    /// Destructor joins all worker threads; queued tasks are discarded
+    ~ThreadPool();
+
+    /**
+     * Schedules a task for execution on the pool.
+     *
+     * @param task the task to run
+     */
+    void submit(function<void()> task);
+
+    /**
+     * Runs one pending task on the calling thread, if there is any.
+     *
+     * @return {@code true} if a task was run; {@code false} otherwise
+     */
+    bool tryRunPending();
+
+    /**
+     * Returns the number of worker threads in this pool.
+     *
+     * @return the number of worker threads in this pool
+     */
+    [[nodiscard]] inline unsigned int size() const {
+        return workers.size();
+    }
+
+private:
+    /// a deque of tasks padded to its own cache line to avoid false sharing
+    struct alignas(64) WorkQueue {
+        mutex lock;
+        deque<function<void()>> tasks;
+    };
+
+    /// queues[i] belongs to worker i; the last queue is shared by outside threads
+    vector<unique_ptr<WorkQueue>> queues;
+
+    /// the worker threads
+    vector<thread> workers;
+
+    /// the number of tasks queued but not yet started
+    atomic<int> pending;
+
+    /// set when the pool is being destroyed
+    atomic<bool> done;
+
+    /// used to park idle workers
+    mutex sleepLock;
+    condition_variable wakeUp;
+
+    /// the index of the calling thread's own queue
+    unsigned int ownQueue();
+
+    /// the main loop of worker i
+    void workerLoop(unsigned int i);
+
+    /// pops from the back of queue i or steals from the front of the others
+    bool take(unsigned int i, function<void()> &task);
+};
+
+/**
+ *  The {@code TaskGroup} class tracks a set of tasks forked onto a
+ *  {@code ThreadPool} so that they can be joined.
+ *
+ *  @author Benjamin Chan
+ */
+class TaskGroup {
+public:
+    explicit TaskGroup(ThreadPool &pool) : pool(pool), pending(0) {};
+
+    /// Prevents the invocation of the constructor with an lvalue group
+    TaskGroup(const TaskGroup &other) = delete;
+
+    /// Destructor joins any tasks that are still running
+    ~TaskGroup() {
+        wait();
+    }
+
+    /**
+     * Forks a task onto the pool.
+     *
+     * @param task the task to run
+     */
+    template<typename F>
+    void run(F &&task) {
+        pending.fetch_add(1, memory_order_relaxed);
+        pool.submit([this, task = forward<F>(task)]() mutable {
+            task();
+            pending.fetch_sub(1, memory_order_release);
+        });
+    }
+
+    /**
+     * Joins all tasks forked from this group, running pending work on the
+     * calling thread while waiting.
+     */
+    void wait() {
+        while (pending.load(memory_order_acquire) > 0) {
+            if (!pool.tryRunPending()) this_thread::yield();
+        }
+    }
+
+private:
+    ThreadPool &pool;
+    atomic<int> pending;
+};
+
+#endif //ALGORITHMS_THREADPOOL_HPP
@@ -0,0 +1,167 @@
+#ifndef ALGORITHMS_TOPK_HPP
+#define ALGORITHMS_TOPK_HPP
+
+#include <span>                     // std::span
+#include <vector>                   // std::vector
+#include <algorithm>                // std::min, std::reverse
+#include <exception>                // std::exception
+#include <stdexcept>                // std::invalid_argument
+#include "Comparable.hpp"           // includes Comparable concept used as a constraint
+#include "MinPQ.hpp"                // the heap of the k largest keys
+
+using namespace std;
+
+/**
+ *  The {@code TopK} class keeps the k largest keys of a stream of generic
+ *  keys of any length, in memory proportional to k. It supports offering a
+ *  key or a batch of keys, peeking at the smallest key kept, merging the
+ *  keys kept by another instance, and listing the keys kept in order.
+ *
+ *  This implementation keeps the k largest keys so far on a {@code MinPQ}.
+ *  Once k keys are kept, the smallest of them is the threshold that a new
+ *  key must exceed, and it is kept in a member of its own, so a key that
+ *  does not make the cut costs one compare and never reaches the heap. A key
+ *  that does replaces the smallest one with a single sink. On a random stream
+ *  of n keys, only about k ln(n / k) of them get past the threshold. Instances
+ *  filled by different threads are combined with {@code merge}.
+ *
+ *  The offer operation takes Θ(1) time for a key that is rejected and
+ *  Θ(log(k)) time otherwise; the min, size and is-empty operations take Θ(1)
+ *  time; listing the keys takes Θ(k log(k)) time.
+ *
+ *  @author Benjamin Chan
+ *
+ *  @param <T> the generic type of a key
+ */
+template<typename T> requires Comparable<T>
+class TopK {
+public:
+    /**
+     * Initializes an empty top-k of the given capacity.
+     *
+     * @param  k the number of largest keys to keep
+     * @throws invalid_argument if {@code k < 1}
+     */
+    explicit TopK(int k) : k(k) {
+        if (k < 1) throw invalid_argument("k is less than one.");
+    }
+
+    /**
+     * Returns true if no key has been kept.
+     *
+     * @return {@code true} if no key has been kept; {@code false} otherwise
+     */
+    bool isEmpty() {
+        return pq.isEmpty();
+    }
+
+    /**
+     * Returns the number of keys kept, which is at most k.
+     *
+     * @return the number of keys kept
+     */
+    int size() {
+        return pq.size();
+    }
+
+    /**
+     * Returns the number of largest keys this top-k keeps.
+     *
+     * @return k
+     */
+    int capacity() const {
+        return k;
+    }
+
+    /**
+     * Returns the smallest key kept: once k keys are kept, the key that a new
+     * key must exceed to be kept.
+     *
+     * @return the smallest key kept
+     * @throws NoSuchElementException if no key has been kept
+     */
+    T min() {
+        if (isEmpty()) throw NoSuchElementException();
+        return pq.min();
+    }
+
+    /**
+     * Offers a key, which is kept if it is among the k largest so far.
+     *
+     * @param  x the key
+     */
+    void offer(const T &x) {
+        if (pq.size() < k) {
+            pq.insert(x);
+            if (pq.size() == k) threshold = pq.min();
+        } else if (threshold < x) {
+            pq.replaceMin(x);
+            threshold = pq.min();
+        }
+    }
+
+    /**
+     * Offers a batch of keys. The keys that fill the top-k are heap-ordered
+     * together, and the rest are compared against the threshold in a tight loop.
+     *
+     * @param  keys the keys
+     */
+    void offerBatch(span<const T> keys);
+
+    /**
+     * Offers all keys kept by another top-k to this one, leaving the other one empty.
+     *
+     * @param  other the top-k to absorb
+     */
+    void merge(TopK<T> &&other) {
+        vector<T> keys;
+        other.pq.popK(other.pq.size(), keys);
+        offerBatch(keys);
+    }
+
+    /**
+     * Returns the keys kept, which are the k largest keys offered so far, or
+     * all of them if fewer were offered.
+     *
+     * @return the keys kept in descending order
+     */
+    vector<T> keys() const {
+        MinPQ<T, 4> copy = pq;
+        vector<T> keys;
+        copy.popK(copy.size(), keys);
+        reverse(keys.begin(), keys.end());
+        return keys;
+    }
+
+    /**
+     * @def the NoSuchElementException if no key has been kept
+     */
+    struct NoSuchElementException : public std::exception {
+        [[nodiscard]] const char *what() const noexcept override {
+            return "Priority Queue Underflow";
+        }
+    };
+
+private:
+    int k;              // the number of largest keys to keep
+    MinPQ<T, 4> pq;     // the largest keys so far, at most k of them
+    T threshold{};      // the smallest key on pq once it holds k keys
+};
+
+template<typename T>
+requires Comparable<T>
+void TopK<T>::offerBatch(span<const T> keys) {
+    size_t fill = std::min<size_t>(keys.size(), k - pq.size());
+    if (fill > 0) {
+        pq.insertBatch(keys.first(fill));
+        if (pq.size() == k) threshold = pq.min();
+    }
+    for (size_t i = fill; i < keys.size(); i++) {
+        if (threshold < keys[i]) {
+            pq.replaceMin(keys[i]);
+            threshold = pq.min();
+        }
+    }
+}
+
+#endif //ALGORITHMS_TOPK_HPP
@@ -1,21 +1,46 @@
 #include <chrono>
 #include <fstream>
 #include <cassert>
+#include <thread>
+#include <atomic>
+#include <cmath>
+#include <optional>
+#include <climits>
+#include <filesystem>
 #include "Bag.hpp"
 #include "Queue.hpp"
+#include "ResizingArrayQueue.hpp"
+#include "ConcurrentQueue.hpp"
 #include "Stack.hpp"
+#include "PoolAllocator.hpp"
 #include "WeightedQuickUnionUF.hpp"
+#include "ConcurrentUF.hpp"
+#include "In.hpp"
 #include "SelectionSort.hpp"
 #include "InsertionSort.hpp"
 #include "ShellSort.hpp"
 #include "MergeSort.hpp"
 #include "MergeSortBU.hpp"
+#include "ThreadPool.hpp"
 #include "QuickSort.hpp"
 #include "QuickSort3way.hpp"
+#include "LSD.hpp"
+#include "MSD.hpp"
+#include "Quick3string.hpp"
+#include "ExternalSort.hpp"
 #include "BinarySearch.hpp"
+#include "EytzingerIndex.hpp"
+#include "LearnedIndex.hpp"
 #include "QuickSelect.hpp"
 #include "MaxPQ.hpp"
 #include "MinPQ.hpp"
+#include "IndexMinPQ.hpp"
+#include "IndexMaxPQ.hpp"
+#include "PairingHeap.hpp"
+#include "RadixHeap.hpp"
+#include "ConcurrentMinPQ.hpp"
+#include "TopK.hpp"
+#include "QuantileSketch.hpp"
 
 
 using namespace std;
@@ -93,6 +118,121 @@ int main() {
 
     cout << "Finished Stack: " << duration_cast<milliseconds>(t1 - t0).count() << " msecs\n" << endl;
 
+    // Tests the stack and queue sharing one pooled node allocator
+    cout << "Testing Pooled Stack and Queue: ";
+    PoolAllocator<string> pooledNodes;
+    Stack<string, PoolAllocator<string>> pooledStack(pooledNodes);
+    Queue<string, PoolAllocator<string>> pooledQueue(pooledNodes);
+
+    testFile.clear();
+    testFile.open("./Test Files/to_be.txt");
+    if (testFile.is_open()) {
+        t0 = high_resolution_clock::now();
+        string input;
+        while (testFile >> input) {
+            if (!(input == "-")) {
+                pooledStack.push(input);
+                pooledQueue.enqueue(input);
+            } else if (!pooledStack.isEmpty()) {
+                cout << pooledStack.pop() + "/" + pooledQueue.dequeue() + " ";
+            }
+        }
+        cout << endl;
+        testFile.close();
+    }
+    assert(pooledStack.toString() == stack.toString());
+    assert(pooledQueue.toString() == queue.toString());
+
+    // a type aligned more strictly than the blocks of the arena still gets aligned storage
+    {
+        struct alignas(64) CacheLine {
+            int value;
+        };
+        PoolAllocator<CacheLine> lines(pooledNodes);
+        vector<CacheLine *> allocated;
+        for (int i = 0; i < 10; i++) allocated.push_back(lines.allocate(1));
+        for (CacheLine *line: allocated) {
+            assert(reinterpret_cast<uintptr_t>(line) % alignof(CacheLine) == 0);
+            lines.deallocate(line, 1);
+        }
+    }
+
+    cout << "Remaining Items in the Pooled Stack: " << pooledStack;
+
+    t1 = high_resolution_clock::now();
+
+    cout << "Finished Pooled Stack and Queue: " << duration_cast<milliseconds>(t1 - t0).count() << " msecs\n" << endl;
+
+    // Tests the resizing array queue
+    cout << "Testing Resizing Array Queue: ";
+    ResizingArrayQueue<string> arrayQueue;
+
+    testFile.clear();
+    testFile.open("./Test Files/to_be.txt");
+    if (testFile.is_open()) {
+        t0 = high_resolution_clock::now();
+        string input;
+        while (testFile >> input) {
+            if (!(input == "-"))
+                arrayQueue.enqueue(input);
+            else if (!arrayQueue.isEmpty())
+                cout << arrayQueue.dequeue() + " ";
+        }
+        testFile.close();
+        cout << endl;
+    }
+    assert(arrayQueue.toString() == queue.toString());
+
+    cout << "Remaining Items in the Resizing Array Queue: " << arrayQueue;
+
+    // Tests the bulk operations of the resizing array queue across the wrap-around point
+    ResizingArrayQueue<int> bulkQueue;
+    vector<int> batch(100), drained(100);
+    int nextIn = 0, nextOut = 0;
+    for (int round = 0; round < 20; round++) {
+        for (auto &x: batch) x = nextIn++;
+        bulkQueue.enqueueBulk(batch);
+        int count = bulkQueue.dequeueBulk(span<int>(drained).first(60 + round));
+        for (int i = 0; i < count; i++) assert(drained[i] == nextOut++);
+    }
+    while (!bulkQueue.isEmpty()) assert(bulkQueue.dequeue() == nextOut++);
+    assert(nextOut == nextIn);
+
+    t1 = high_resolution_clock::now();
+
+    cout << "Finished Resizing Array Queue: " << duration_cast<milliseconds>(t1 - t0).count() << " msecs\n" << endl;
+
+    // Tests the concurrent queue with several producers and consumers
+    cout << "Testing Concurrent Queue: ";
+    t0 = high_resolution_clock::now();
+    ConcurrentQueue<int> boundedQueue(4);
+    int dropped;
+    for (int i = 0; i < 4; i++) assert(boundedQueue.tryEnqueue(i));
+    assert(!boundedQueue.tryEnqueue(4));
+    for (int i = 0; i < 4; i++) assert(boundedQueue.tryDequeue(dropped) && dropped == i);
+    assert(!boundedQueue.tryDequeue(dropped) && boundedQueue.isEmpty());
+
+    ConcurrentQueue<int> concurrentQueue(64);
+    vector<thread> handOff;
+    atomic<long> received(0);
+    for (int p = 0; p < 4; p++) {
+        handOff.emplace_back([&concurrentQueue, p] {
+            for (int i = 1; i <= 10000; i++) concurrentQueue.enqueue(p * 10000 + i);
+        });
+        handOff.emplace_back([&concurrentQueue, &received] {
+            long sum = 0;
+            for (int i = 0; i < 10000; i++) sum += concurrentQueue.dequeue();
+            received += sum;
+        });
+    }
+    for (auto &worker: handOff) worker.join();
+    // every item 1 .. 40000 is received exactly once
+    assert(received == 40000L * 40001 / 2 && concurrentQueue.isEmpty());
+    cout << "received " << received << endl;
+    t1 = high_resolution_clock::now();
+
+    cout << "Finished Concurrent Queue: " << duration_cast<milliseconds>(t1 - t0).count() << " msecs\n" << endl;
+
     // Tests the union-find (weighted)
     testFile.clear();
     testFile.open("./Test Files/tiny_UF.txt");
@@ -117,6 +257,80 @@ int main() {
 
     cout << "Finished WeightedQuickUnionUF: " << duration_cast<milliseconds>(t1 - t0).count() << " msecs\n" << endl;
 
+    // Tests the concurrent union-find against the sequential union-find
+    ThreadPool pool;
+    {
+        In in("./Test Files/medium_UF.txt");
+        int size = in.readInt();
+        vector<pair<int, int>> pairs = in.readAllIntPairs();
+        t0 = high_resolution_clock::now();
+        ConcurrentUF concurrentUF = ConcurrentUF(size);
+        concurrentUF.unionBatch(pairs, pool);
+        t1 = high_resolution_clock::now();
+
+        WeightedQuickUnionUF uf = WeightedQuickUnionUF(size);
+        for (const auto &[p, q]: pairs) {
+            uf.weightedUnion(p, q);
+        }
+        assert(concurrentUF.count() == uf.count());
+        for (int i = 0; i < size; i++) {
+            assert(concurrentUF.connected(i, uf.find(i)));
+        }
+        cout << to_string(concurrentUF.count()) + " components" << endl;
+    }
+
+    cout << "Finished ConcurrentUF: " << duration_cast<milliseconds>(t1 - t0).count() << " msecs\n" << endl;
+
+    // Tests the memory-mapped input against stream extraction
+    {
+        t0 = high_resolution_clock::now();
+        In numbers("./Test Files/random_numbers.txt");
+        vector<int> mappedInts = numbers.readAllInts();
+        In strings("./Test Files/random_strings.txt");
+        vector<string_view> mappedStrings = strings.readAllStrings();
+        t1 = high_resolution_clock::now();
+
+        testFile.clear();
+        testFile.open("./Test Files/random_numbers.txt");
+        vector<int> streamedInts;
+        int number;
+        while (testFile >> number) streamedInts.emplace_back(number);
+        testFile.close();
+        assert(mappedInts == streamedInts);
+
+        testFile.clear();
+        testFile.open("./Test Files/random_strings.txt");
+        vector<string> streamedStrings;
+        string str;
+        while (testFile >> str) streamedStrings.emplace_back(str);
+        testFile.close();
+        assert(equal(mappedStrings.begin(), mappedStrings.end(), streamedStrings.begin(), streamedStrings.end()));
+
+        // the views can be sorted in place without copying the strings
+        MergeSort{mappedStrings};
+        MergeSort{streamedStrings};
+        assert(equal(mappedStrings.begin(), mappedStrings.end(), streamedStrings.begin(), streamedStrings.end()));
+        cout << "read " << mappedInts.size() << " ints and " << mappedStrings.size() << " strings" << endl;
+
+        // leading zeros do not count towards the digits of an int, but the value still has to fit
+        string path = filesystem::temp_directory_path().string() + "/InTest.txt";
+        ofstream(path) << "000000000042 -0000000000002147483648 +0007 2147483647 0 00 0000000000002147483648\n";
+        In padded(path);
+        vector<int> paddedInts;
+        for (int i = 0; i < 6; i++) paddedInts.push_back(padded.readInt());
+        assert((paddedInts == vector<int>{42, INT_MIN, 7, INT_MAX, 0, 0}));
+        bool threw = false;
+        try {
+            padded.readInt();
+        } catch (const invalid_argument &) {
+            threw = true;
+        }
+        assert(threw);
+        filesystem::remove(path);
+    }
+
+    cout << "Finished In: " << duration_cast<milliseconds>(t1 - t0).count() << " msecs\n" << endl;
+
     // Tests the selection sort algorithm on strings
     testFile.clear();
     testFile.open("./Test Files/random_strings.txt");
@@ -453,6 +667,43 @@ int main() {
 
     cout << "Finished Merge Reverse Sort: " << duration_cast<milliseconds>(t1 - t0).count() << " msecs\n" << endl;
 
+    // Tests the parallel merge sort algorithm on strings against the sequential merge sort
+    testFile.clear();
+    testFile.open("./Test Files/random_strings.txt");
+    vector<string> stringVectorParallel;
+    if (testFile.is_open()) {
+        string str;
+        while (testFile >> str) {
+            stringVectorParallel.emplace_back(str);
+        }
+        testFile.close();
+        t0 = high_resolution_clock::now();
+        MergeSort{stringVectorParallel, pool, false, 64};
+    }
+    t1 = high_resolution_clock::now();
+    assert(stringVectorParallel == stringVector7);
+
+    cout << "Finished Parallel Merge Sort: " << duration_cast<milliseconds>(t1 - t0).count() << " msecs\n" << endl;
+
+    // Tests the parallel merge reverse sort algorithm on strings against the sequential merge sort
+    testFile.clear();
+    testFile.open("./Test Files/random_strings.txt");
+    vector<string> stringVectorParallel2;
+    if (testFile.is_open()) {
+        string str;
+        while (testFile >> str) {
+            stringVectorParallel2.emplace_back(str);
+        }
+        testFile.close();
+        t0 = high_resolution_clock::now();
+        MergeSort{stringVectorParallel2, pool, true, 64};
+    }
+    t1 = high_resolution_clock::now();
+    assert(stringVectorParallel2 == stringVector8);
+
+    cout << "Finished Parallel Merge Reverse Sort: " << duration_cast<milliseconds>(t1 - t0).count() << " msecs\n"
+         << endl;
+
     // Tests the merge sort bottom-up algorithm on strings
     testFile.clear();
     testFile.open("./Test Files/random_strings.txt");
@@ -537,6 +788,116 @@ int main() {
 
     cout << "Finished Merge Sort Bottom-Up: " << duration_cast<milliseconds>(t1 - t0).count() << " msecs\n" << endl;
 
+    // Tests the natural runs mode of the merge sort bottom-up algorithm against the power-of-two mode
+    testFile.clear();
+    testFile.open("./Test Files/random_strings.txt");
+    vector<string> stringVectorNatural;
+    if (testFile.is_open()) {
+        string str;
+        while (testFile >> str) {
+            stringVectorNatural.emplace_back(str);
+        }
+        testFile.close();
+        vector<string> stringVectorNatural2 = stringVectorNatural;
+        t0 = high_resolution_clock::now();
+        MergeSortBU{stringVectorNatural, MergeSortBUMode::NaturalRuns};
+        MergeSortBU{stringVectorNatural2, MergeSortBUMode::NaturalRuns, true};
+        t1 = high_resolution_clock::now();
+        assert(stringVectorNatural == stringVector9);
+        assert(stringVectorNatural2 == stringVector10);
+    }
+
+    // Tests that the natural runs mode is stable on inputs with runs, with descending runs and with equal keys
+    {
+        struct Record {
+            int key;
+            int order;
+            auto operator<=>(const Record &that) const { return key <=> that.key; }
+            bool operator==(const Record &that) const { return key == that.key; }
+        };
+        mt19937 g(2021);
+        int n = 100000;
+        vector<vector<Record>> inputs(5, vector<Record>(n));
+        for (int i = 0; i < n; i++) {
+            inputs[0][i] = {i < n * 9 / 10 ? i / 3 : (int) (g() % n), i};
+            inputs[1][i] = {(i / 1000) * 1000 + 1000 - i % 1000 + (int) (g() % 4), i};
+            inputs[2][i] = {7, i};
+            inputs[3][i] = {(int) (g() % 1000), i};
+            inputs[4][i] = {n - i, i};
+        }
+        for (auto &input: inputs) {
+            vector<Record> expected = input;
+            vector<Record> expectedReverse = input;
+            vector<Record> reverse = input;
+            stable_sort(expected.begin(), expected.end());
+            stable_sort(expectedReverse.begin(), expectedReverse.end(), greater<Record>());
+            MergeSortBU{input, MergeSortBUMode::NaturalRuns};
+            MergeSortBU{reverse, MergeSortBUMode::NaturalRuns, true};
+            auto same = [](const Record &x, const Record &y) { return x.key == y.key && x.order == y.order; };
+            assert(equal(input.begin(), input.end(), expected.begin(), same));
+            assert(equal(reverse.begin(), reverse.end(), expectedReverse.begin(), same));
+        }
+    }
+
+    cout << "Finished Merge Sort Bottom-Up Natural Runs: " << duration_cast<milliseconds>(t1 - t0).count()
+         << " msecs\n" << endl;
+
+    // Tests the memory-bounded mode of both merge sorts with scratch buffers of several sizes
+    testFile.clear();
+    testFile.open("./Test Files/random_strings.txt");
+    vector<string> stringVectorBounded;
+    if (testFile.is_open()) {
+        string str;
+        while (testFile >> str) {
+            stringVectorBounded.emplace_back(str);
+        }
+        testFile.close();
+        int n = stringVectorBounded.size();
+        t0 = high_resolution_clock::now();
+        for (int size: {0, 1, (int) sqrt(n), n / 8, n}) {
+            vector<string> buffer(size);
+            vector<string> topDown = stringVectorBounded, topDown2 = stringVectorBounded;
+            vector<string> bottomUp = stringVectorBounded, bottomUp2 = stringVectorBounded;
+            MergeSort{topDown, buffer};
+            MergeSort{topDown2, buffer, true};
+            MergeSortBU{bottomUp, buffer};
+            MergeSortBU{bottomUp2, buffer, true};
+            assert(topDown == stringVector7);
+            assert(topDown2 == stringVector8);
+            assert(bottomUp == stringVector9);
+            assert(bottomUp2 == stringVector10);
+        }
+        t1 = high_resolution_clock::now();
+    }
+
+    // Tests that the memory-bounded mode is stable
+    {
+        struct Record {
+            int key;
+            int order;
+            auto operator<=>(const Record &that) const { return key <=> that.key; }
+            bool operator==(const Record &that) const { return key == that.key; }
+        };
+        mt19937 g(2021);
+        int n = 20000;
+        vector<Record> input(n);
+        for (int i = 0; i < n; i++) input[i] = {(int) (g() % 100), i};
+        vector<Record> expected = input;
+        stable_sort(expected.begin(), expected.end());
+        auto same = [](const Record &x, const Record &y) { return x.key == y.key && x.order == y.order; };
+        for (int size: {0, 7, 141, n / 2}) {
+            vector<Record> buffer(size);
+            vector<Record> topDown = input, bottomUp = input;
+            MergeSort{topDown, buffer};
+            MergeSortBU{bottomUp, buffer};
+            assert(equal(topDown.begin(), topDown.end(), expected.begin(), same));
+            assert(equal(bottomUp.begin(), bottomUp.end(), expected.begin(), same));
+        }
+    }
+
+    cout << "Finished Merge Sort Memory-Bounded: " << duration_cast<milliseconds>(t1 - t0).count() << " msecs\n"
+         << endl;
+
     // Tests the quick sort algorithm on strings
     testFile.clear();
     testFile.open("./Test Files/random_strings.txt");
@@ -621,6 +982,208 @@ int main() {
 
     cout << "Finished Quick Reverse Sort: " << duration_cast<milliseconds>(t1 - t0).count() << " msecs\n" << endl;
 
+    // Tests the introsort mode of the quick sort algorithm against the shuffled mode
+    testFile.clear();
+    testFile.open("./Test Files/random_strings.txt");
+    vector<string> stringVectorIntro;
+    if (testFile.is_open()) {
+        string str;
+        while (testFile >> str) {
+            stringVectorIntro.emplace_back(str);
+        }
+        testFile.close();
+        vector<string> stringVectorIntro2 = stringVectorIntro;
+        vector<string> stringVectorBlock = stringVectorIntro;
+        vector<string> stringVectorBlock2 = stringVectorIntro;
+        t0 = high_resolution_clock::now();
+        QuickSort{stringVectorIntro, QuickSortMode::Introsort};
+        QuickSort{stringVectorIntro2, QuickSortMode::Introsort, true};
+        QuickSort{stringVectorBlock, QuickSortMode::BlockIntrosort};
+        QuickSort{stringVectorBlock2, QuickSortMode::BlockIntrosort, true};
+        t1 = high_resolution_clock::now();
+        assert(stringVectorIntro == stringVector11);
+        assert(stringVectorIntro2 == stringVector12);
+        assert(stringVectorBlock == stringVector11);
+        assert(stringVectorBlock2 == stringVector12);
+    }
+
+    // Tests the introsort mode on inputs that are hard for a fixed choice of partitioning item
+    {
+        vector<vector<int>> inputs(4, vector<int>(5000));
+        for (int i = 0; i < 5000; i++) {
+            inputs[0][i] = i;
+            inputs[1][i] = 7;
+            inputs[2][i] = min(i, 4999 - i);
+            inputs[3][i] = i % 2 == 0 ? i : 5000 - i;
+        }
+        for (auto &input: inputs) {
+            vector<int> expected = input;
+            vector<int> block = input;
+            std::sort(expected.begin(), expected.end());
+            QuickSort{input, QuickSortMode::Introsort};
+            QuickSort{block, QuickSortMode::BlockIntrosort};
+            assert(input == expected);
+            assert(block == expected);
+        }
+    }
+
+    cout << "Finished Quick Sort Introsort: " << duration_cast<milliseconds>(t1 - t0).count() << " msecs\n" << endl;
+
+    // Tests the LSD radix sort algorithm on fixed-width strings against the quick sort
+    testFile.clear();
+    testFile.open("./Test Files/random_strings.txt");
+    vector<string> stringVectorLSD;
+    if (testFile.is_open()) {
+        string str;
+        while (testFile >> str) {
+            stringVectorLSD.emplace_back(str);
+        }
+        testFile.close();
+        vector<string> stringVectorLSD2 = stringVectorLSD;
+        t0 = high_resolution_clock::now();
+        LSD{stringVectorLSD, 5};
+        LSD{stringVectorLSD2, 5, true};
+        t1 = high_resolution_clock::now();
+        assert(stringVectorLSD == stringVector11);
+        assert(stringVectorLSD2 == stringVector12);
+    }
+
+    // Tests the LSD radix sort algorithm on signed and unsigned integers and on records by an integer field
+    {
+        mt19937 g(2021);
+        vector<int> ints(100000);
+        for (auto &x: ints) x = (int) g();
+        vector<int> intsReverse = ints;
+        vector<int> expected = ints;
+        std::sort(expected.begin(), expected.end());
+        LSD{ints};
+        LSD{intsReverse, true};
+        assert(ints == expected);
+        assert(equal(intsReverse.rbegin(), intsReverse.rend(), expected.begin()));
+
+        vector<uint64_t> longs(100000);
+        for (auto &x: longs) x = ((uint64_t) g() << 32 | g()) >> (g() % 40);
+        vector<uint64_t> expectedLongs = longs;
+        std::sort(expectedLongs.begin(), expectedLongs.end());
+        LSD{longs};
+        assert(longs == expectedLongs);
+
+        // records with equal keys must keep their order
+        vector<pair<short, int>> records(10000);
+        for (int i = 0; i < 10000; i++) records[i] = {(short) (g() % 200 - 100), i};
+        vector<pair<short, int>> expectedRecords = records;
+        stable_sort(expectedRecords.begin(), expectedRecords.end(),
+                    [](const auto &x, const auto &y) { return x.first < y.first; });
+        LSD{records, [](const pair<short, int> &record) { return record.first; }};
+        assert(records == expectedRecords);
+    }
+
+    cout << "Finished LSD Radix Sort: " << duration_cast<milliseconds>(t1 - t0).count() << " msecs\n" << endl;
+
+    // Tests the MSD radix sort and 3-way radix quicksort algorithms on strings against the quick sort
+    testFile.clear();
+    testFile.open("./Test Files/random_strings.txt");
+    vector<string> stringVectorMSD;
+    if (testFile.is_open()) {
+        string str;
+        while (testFile >> str) {
+            stringVectorMSD.emplace_back(str);
+        }
+        testFile.close();
+        vector<string> stringVectorMSD2 = stringVectorMSD;
+        vector<string> stringVectorQuick3string = stringVectorMSD;
+        vector<string> stringVectorQuick3string2 = stringVectorMSD;
+        t0 = high_resolution_clock::now();
+        MSD{stringVectorMSD};
+        MSD{stringVectorMSD2, true};
+        Quick3string{stringVectorQuick3string};
+        Quick3string{stringVectorQuick3string2, true};
+        t1 = high_resolution_clock::now();
+        assert(stringVectorMSD == stringVector11);
+        assert(stringVectorMSD2 == stringVector12);
+        assert(stringVectorQuick3string == stringVector11);
+        assert(stringVectorQuick3string2 == stringVector12);
+    }
+
+    // Tests the string sorts on strings of different lengths with long common prefixes
+    {
+        mt19937 g(2021);
+        vector<string> words(20000);
+        for (auto &word: words) {
+            word = string(g() % 4, 'a');
+            for (int length = g() % 8; length > 0; length--) word += (char) ('a' + g() % 3);
+        }
+        vector<string> expected = words;
+        std::sort(expected.begin(), expected.end());
+        vector<string> wordsReverse = words;
+        vector<string> wordsQuick3string = words;
+        MSD{words};
+        MSD{wordsReverse, true};
+        Quick3string{wordsQuick3string};
+        assert(words == expected);
+        assert(equal(wordsReverse.rbegin(), wordsReverse.rend(), expected.begin()));
+        assert(wordsQuick3string == expected);
+    }
+
+    cout << "Finished MSD and Quick3string: " << duration_cast<milliseconds>(t1 - t0).count() << " msecs\n" << endl;
+
+    // Tests the external sort on a file of ints 16 times the memory budget, which is enough for 3-way merges only
+    {
+        mt19937 g(2021);
+        vector<int> ints(1 << 20);
+        for (auto &x: ints) x = (int) g();
+        string directory = filesystem::temp_directory_path().string();
+        string input = directory + "/ExternalSortTest.in", output = directory + "/ExternalSortTest.out";
+        FILE *file = fopen(input.c_str(), "wb");
+        fwrite(ints.data(), sizeof(int), ints.size(), file);
+        fclose(file);
+
+        auto readInts = [](const string &path) {
+            vector<int> result(filesystem::file_size(path) / sizeof(int));
+            FILE *file = fopen(path.c_str(), "rb");
+            fread(result.data(), sizeof(int), result.size(), file);
+            fclose(file);
+            return result;
+        };
+        vector<int> expected = ints;
+        std::sort(expected.begin(), expected.end());
+        t0 = high_resolution_clock::now();
+        ExternalSort<int> sort(input, output, ints.size() * sizeof(int) / 16);
+        t1 = high_resolution_clock::now();
+        assert(sort.runs() == 16);
+        assert(sort.passes() == 3);
+        assert(readInts(output) == expected);
+
+        ExternalSort<int>(input, output, 1 << 20, true);
+        assert(equal(expected.rbegin(), expected.rend(), readInts(output).begin()));
+
+        // a budget larger than the file gives a single run
+        ExternalSort<int> single(input, output, 1 << 30);
+        assert(single.runs() == 1);
+        assert(readInts(output) == expected);
+
+        // a budget of fewer than three 64 KiB buffers merges two runs at a time
+        ExternalSort<int> small(input, output, 1 << 15);
+        assert(small.runs() == 128 && small.passes() == 7);
+        assert(readInts(output) == expected);
+
+        // the runs are removed when the output cannot be written
+        string runDirectory = directory + "/ExternalSortTestRuns";
+        filesystem::create_directory(runDirectory);
+        bool threw = false;
+        try {
+            ExternalSort<int>(input, runDirectory + "/missing/ExternalSortTest.out", 1 << 20, false, runDirectory);
+        } catch (const runtime_error &) {
+            threw = true;
+        }
+        assert(threw && filesystem::is_empty(runDirectory));
+        filesystem::remove(runDirectory);
+        filesystem::remove(input);
+        filesystem::remove(output);
+    }
+
+    cout << "Finished External Sort: " << duration_cast<milliseconds>(t1 - t0).count() << " msecs\n" << endl;
+
     // Tests the quick 3-way sort algorithm on strings
     testFile.clear();
     testFile.open("./Test Files/random_strings.txt");
@@ -727,6 +1290,124 @@ int main() {
     // finding 3 should return the index of 2
     assert(result4 == 2);
 
+    // Tests the batched binary search against indexOf, which it must match exactly, including the index
+    // it finds among equal keys, in both orders and with a number of keys that is not a multiple of the lanes
+    {
+        mt19937 g(2021);
+        t0 = high_resolution_clock::now();
+        for (int n: {0, 1, 2, 5, 16, 17, 100, 1000}) {
+            vector<int> sorted(n);
+            for (auto &key: sorted) key = (int) (g() % (n + 1)) - n / 2;
+            vector<int> keys(3 * n + 5);
+            for (auto &key: keys) key = (int) (g() % (2 * n + 3)) - n - 1;
+            vector<int> out(keys.size());
+            for (bool reverse: {false, true}) {
+                sort(sorted.begin(), sorted.end());
+                if (reverse) std::reverse(sorted.begin(), sorted.end());
+                BinarySearch::indexOfBatch(span<const int>(sorted), span<const int>(keys), span<int>(out), reverse);
+                for (size_t i = 0; i < keys.size(); i++)
+                    assert(out[i] == BinarySearch::indexOf(span<int>(sorted), keys[i], reverse));
+            }
+        }
+        t1 = high_resolution_clock::now();
+
+        vector<string> words = {"best", "it", "of", "the", "times", "was", "worst"};
+        vector<string> lookups = {"the", "age", "worst"};
+        vector<int> found(3);
+        BinarySearch::indexOfBatch(span<const string>(words), span<const string>(lookups), span<int>(found));
+        assert(found == vector<int>({3, -1, 6}));
+    }
+
+    cout << "Finished Testing Batched Binary Search: " << duration_cast<milliseconds>(t1 - t0).count() << " msecs\n"
+         << endl;
+
+    // Tests the Eytzinger search index against lower_bound, on every size up to 100 and on a large table
+    // with repeated keys
+    {
+        mt19937 g(2021);
+        t0 = high_resolution_clock::now();
+        for (int n: {0, 1, 2, 3, 7, 8, 9, 15, 16, 17, 31, 32, 33, 64, 99, 100, 100000}) {
+            vector<int> sorted(n);
+            for (auto &key: sorted) key = (int) (g() % (2 * n + 1)) * 2;
+            sort(sorted.begin(), sorted.end());
+            EytzingerIndex index(sorted);
+            assert(index.size() == n);
+            for (int key = -1; key <= 4 * n + 2; key += n < 100 ? 1 : 7) {
+                int rank = (int) (lower_bound(sorted.begin(), sorted.end(), key) - sorted.begin());
+                assert(index.rank(key) == rank && index.lowerBound(key) == rank);
+                bool present = rank < n && sorted[rank] == key;
+                assert(index.indexOf(key) == (present ? rank : -1));
+            }
+        }
+        t1 = high_resolution_clock::now();
+
+        vector<string> words = {"best", "it", "of", "the", "times", "was", "worst"};
+        EytzingerIndex<string> wordIndex{words};
+        assert(wordIndex.indexOf("the") == 3 && wordIndex.indexOf("age") == -1 && wordIndex.rank("zoo") == 7);
+    }
+
+    cout << "Finished Testing Eytzinger Index: " << duration_cast<milliseconds>(t1 - t0).count() << " msecs\n"
+         << endl;
+
+    // Tests the learned index in both modes against lower_bound, on uniform, clustered and skewed keys with
+    // repeats, for every integer in and around their range
+    {
+        mt19937 g(2021);
+        t0 = high_resolution_clock::now();
+        for (int shape = 0; shape < 3; shape++) {
+            for (int n: {0, 1, 2, 10, 1000, 20000}) {
+                vector<long> sorted(n);
+                for (int i = 0; i < n; i++) {
+                    if (shape == 0) sorted[i] = (long) (g() % (4 * n + 1));
+                    else if (shape == 1) sorted[i] = (long) (g() % 8) * 100000 + (long) (g() % 50);
+                    else sorted[i] = (long) pow(1.001, (double) (g() % 20000));
+                }
+                sort(sorted.begin(), sorted.end());
+                LearnedIndex model(sorted, LearnedIndexMode::PiecewiseLinear, 8);
+                LearnedIndex interpolation(sorted, LearnedIndexMode::Interpolation);
+                if (n >= 1000) assert(model.bytes() < (size_t) n * sizeof(long));
+                long lo = n == 0 ? -2 : sorted.front() - 2, hi = n == 0 ? 2 : sorted.back() + 2;
+                long step = max(1L, (hi - lo) / 50000);
+                for (long key = lo; key <= hi; key += step) {
+                    int rank = (int) (lower_bound(sorted.begin(), sorted.end(), key) - sorted.begin());
+                    assert(model.rank(key) == rank && interpolation.rank(key) == rank);
+                    int index = rank < n && sorted[rank] == key ? rank : -1;
+                    assert(model.indexOf(key) == index && interpolation.indexOf(key) == index);
+                }
+                for (long key: sorted) assert(model.indexOf(key) >= 0 && sorted[model.indexOf(key)] == key);
+            }
+        }
+
+        // nearly uniform keys take a handful of segments
+        vector<int> uniform(100000);
+        for (int i = 0; i < (int) uniform.size(); i++) uniform[i] = 3 * i + (int) (g() % 3);
+        LearnedIndex uniformModel(uniform);
+        assert(uniformModel.segmentCount() <= 10 && uniformModel.lowerBound(3 * 5000) == 5000);
+
+        // 64-bit keys beyond 2^53, whose differences a double only keeps if they are taken first, and keys
+        // that span the whole range of long long
+        for (int trial = 0; trial < 4; trial++) {
+            long long base = 1LL << 60;
+            vector<long long> large(20000);
+            for (long long &key: large) key = base + (long long) (g() % 20000);
+            if (trial % 2 == 1) {
+                large.front() = numeric_limits<long long>::min();
+                large.back() = numeric_limits<long long>::max();
+            }
+            sort(large.begin(), large.end());
+            LearnedIndex model(large, LearnedIndexMode::PiecewiseLinear, 8);
+            LearnedIndex interpolation(large, LearnedIndexMode::Interpolation);
+            for (long long key = base - 2; key <= base + 20002; key++) {
+                int rank = (int) (lower_bound(large.begin(), large.end(), key) - large.begin());
+                assert(model.rank(key) == rank && interpolation.rank(key) == rank);
+            }
+        }
+        t1 = high_resolution_clock::now();
+    }
+
+    cout << "Finished Testing Learned Index: " << duration_cast<milliseconds>(t1 - t0).count() << " msecs\n"
+         << endl;
+
     // Tests quick select algorithm to determine the element in the basic array of rank 5
     // (aka the 6th highest element in the container)
     int testVector2[15] = {50, 21, 28, 65, 39, 59, 56, 22, 95, 12, 90, 53, 32, 77, 33};
@@ -742,6 +1423,124 @@ int main() {
     // finding a rank of 5 should return 33 of testVector
     assert(result6 == 33);
 
+    // Tests the introsort and block partition modes of quick select against a sorted copy
+    {
+        vector<int> keys(10000);
+        for (int i = 0; i < 10000; i++) keys[i] = (i * 7919) % 10007;
+        vector<int> sorted = keys;
+        std::sort(sorted.begin(), sorted.end());
+        for (QuickSortMode mode: {QuickSortMode::Introsort, QuickSortMode::BlockIntrosort}) {
+            for (int rank: {0, 17, 4999, 9999}) {
+                vector<int> copy = keys;
+                assert(QuickSelect(copy, mode).rankOf(rank) == sorted[rank]);
+                assert(QuickSelect(copy, mode).rankOf(rank, true) == sorted[9999 - rank]);
+            }
+        }
+    }
+
+    // Tests the Floyd-Rivest and introselect modes of quick select against a sorted copy, on inputs
+    // that defeat a median of three, with and without sampling
+    {
+        mt19937 g(2021);
+        int n = 100000;
+        vector<vector<int>> inputs(5, vector<int>(n));
+        for (int i = 0; i < n; i++) {
+            inputs[0][i] = (int) g();
+            inputs[1][i] = i;
+            inputs[2][i] = i < n / 2 ? i : n - i;
+            inputs[3][i] = (int) (g() % 4);
+        }
+
+        // the median-of-three killer of Musser: the first, middle and last items are always the smallest
+        for (int i = 0; i < n / 2; i++) {
+            inputs[4][i] = i % 2 == 0 ? i + 1 : n / 2 + i + (n / 2 % 2 == 0 ? 0 : 1);
+            inputs[4][n / 2 + i] = 2 * (i + 1);
+        }
+
+        t0 = high_resolution_clock::now();
+        for (const vector<int> &keys: inputs) {
+            vector<int> sorted = keys;
+            std::sort(sorted.begin(), sorted.end());
+            for (QuickSelectMode mode: {QuickSelectMode::FloydRivest, QuickSelectMode::Introselect}) {
+                for (int rank: {0, 1, 999, n / 2, n - 1000, n - 1}) {
+                    vector<int> copy = keys;
+                    assert(QuickSelect(copy, mode).rankOf(rank) == sorted[rank]);
+                    for (int i = 0; i < rank; i++) assert(copy[i] <= copy[rank]);
+                    for (int i = rank + 1; i < n; i++) assert(copy[rank] <= copy[i]);
+                    copy = keys;
+                    assert(QuickSelect(copy, mode).rankOf(rank, true) == sorted[n - 1 - rank]);
+                }
+            }
+        }
+        t1 = high_resolution_clock::now();
+    }
+
+    cout << "Finished Testing Floyd-Rivest and Introselect: " << duration_cast<milliseconds>(t1 - t0).count()
+         << " msecs\n" << endl;
+
+    // Tests selecting several ranks at once, partial sorting and sorting a range of ranks against a sorted copy
+    {
+        mt19937 g(2021);
+        int n = 100000;
+        vector<int> keys(n);
+        for (int &key: keys) key = (int) (g() % 50000);
+        vector<int> sorted = keys;
+        std::sort(sorted.begin(), sorted.end());
+
+        t0 = high_resolution_clock::now();
+        vector<int> ranks = {n * 999 / 1000, n / 2, 0, n * 9 / 10, n / 2, n - 1, n * 99 / 100, 1};
+        for (QuickSelectMode mode: {QuickSelectMode::FloydRivest, QuickSelectMode::Introselect}) {
+            vector<int> copy = keys;
+            vector<int> quantiles = QuickSelect(copy, mode).ranksOf(ranks);
+            assert(quantiles.size() == ranks.size());
+            for (int i = 0; i < (int) ranks.size(); i++) {
+                assert(quantiles[i] == sorted[ranks[i]]);
+                assert(copy[ranks[i]] == sorted[ranks[i]]);
+            }
+
+            // every key is between the requested ranks around its position
+            vector<int> distinct = ranks;
+            std::sort(distinct.begin(), distinct.end());
+            for (int i = 0, r = 0; i < n; i++) {
+                while (r < (int) distinct.size() && distinct[r] < i) r++;
+                if (r > 0) assert(copy[distinct[r - 1]] <= copy[i]);
+                if (r < (int) distinct.size()) assert(copy[i] <= copy[distinct[r]]);
+            }
+
+            copy = keys;
+            quantiles = QuickSelect(copy, mode).ranksOf(ranks, true);
+            for (int i = 0; i < (int) ranks.size(); i++) assert(quantiles[i] == sorted[n - 1 - ranks[i]]);
+
+            for (int k: {0, 1, 100, 5000, n}) {
+                copy = keys;
+                QuickSelect(copy, mode).partialSort(k);
+                assert(std::equal(copy.begin(), copy.begin() + k, sorted.begin()));
+                if (k > 0) for (int i = k; i < n; i++) assert(copy[k - 1] <= copy[i]);
+                copy = keys;
+                QuickSelect(copy, mode).partialSort(k, true);
+                assert(std::equal(copy.begin(), copy.begin() + k, sorted.rbegin()));
+            }
+
+            copy = keys;
+            QuickSelect(copy, mode).nthElementRange(40000, 40999);
+            assert(std::equal(copy.begin() + 40000, copy.begin() + 41000, sorted.begin() + 40000));
+            for (int i = 0; i < 40000; i++) assert(copy[i] <= copy[40000]);
+            for (int i = 41000; i < n; i++) assert(copy[40999] <= copy[i]);
+        }
+        t1 = high_resolution_clock::now();
+
+        bool thrown = false;
+        try {
+            QuickSelect(keys, QuickSelectMode::FloydRivest).nthElementRange(10, 5);
+        } catch (const invalid_argument &) {
+            thrown = true;
+        }
+        assert(thrown);
+    }
+
+    cout << "Finished Testing Multi-Rank Selection: " << duration_cast<milliseconds>(t1 - t0).count()
+         << " msecs\n" << endl;
+
     // Tests the max priority queue data structure on ints
     MaxPQ<int> maxPQ;
     testFile.clear();
@@ -779,5 +1578,496 @@ int main() {
     cout << "Finished Testing Min Priority Queue: " << duration_cast<milliseconds>(t1 - t0).count() << " msecs\n"
          << endl;
 
+    // Tests the indexed priority queues against a brute-force scan of the keys of every index
+    {
+        mt19937 g(2021);
+        int maxN = 1000;
+        IndexMinPQ<int> indexMinPQ(maxN);
+        IndexMaxPQ<int> indexMaxPQ(maxN);
+        vector<optional<int>> keys(maxN);
+        auto extreme = [&](bool max) {
+            int best = -1;
+            for (int i = 0; i < maxN; i++)
+                if (keys[i] && (best < 0 || (max ? *keys[i] > *keys[best] : *keys[i] < *keys[best]))) best = i;
+            return best;
+        };
+        t0 = high_resolution_clock::now();
+        for (int step = 0; step < 20000; step++) {
+            int i = (int) (g() % maxN);
+            int key = (int) (g() % 100000);
+            if (!keys[i]) {
+                indexMinPQ.insert(i, key);
+                indexMaxPQ.insert(i, key);
+                keys[i] = key;
+            } else if (step % 5 == 0) {
+                indexMinPQ.remove(i);
+                indexMaxPQ.remove(i);
+                keys[i].reset();
+            } else if (key < *keys[i]) {
+                indexMinPQ.decreaseKey(i, key);
+                indexMaxPQ.decreaseKey(i, key);
+                keys[i] = key;
+            } else if (key > *keys[i]) {
+                indexMinPQ.increaseKey(i, key);
+                indexMaxPQ.increaseKey(i, key);
+                keys[i] = key;
+            } else {
+                indexMinPQ.changeKey(i, key);
+                indexMaxPQ.changeKey(i, key);
+            }
+            assert(indexMinPQ.contains(i) == keys[i].has_value());
+            if (step % 7 == 0 && !indexMinPQ.isEmpty()) {
+                int min = extreme(false), max = extreme(true);
+                assert(indexMinPQ.minKey() == *keys[min]);
+                assert(indexMaxPQ.maxKey() == *keys[max]);
+                int j = step % 2 == 0 ? indexMinPQ.delMin() : indexMaxPQ.delMax();
+                if (step % 2 == 0) indexMaxPQ.remove(j);
+                else indexMinPQ.remove(j);
+                keys[j].reset();
+            }
+        }
+        t1 = high_resolution_clock::now();
+        assert(indexMinPQ.size() == (int) count_if(keys.begin(), keys.end(), [](auto &key) { return key.has_value(); }));
+
+        bool threw = false;
+        try {
+            indexMinPQ.insert(maxN, 0);
+        } catch (invalid_argument &) {
+            threw = true;
+        }
+        assert(threw);
+
+        IndexMinPQ<string> names(4);
+        names.insert(2, "it");
+        names.insert(0, "was");
+        names.insert(3, "the");
+        names.insert(1, "best");
+        assert(names.toString() == "1 2 3 0 \n");
+    }
+
+    cout << "Finished Testing Indexed Priority Queues: " << duration_cast<milliseconds>(t1 - t0).count() << " msecs\n"
+         << endl;
+
+    // Tests the 4-ary and 8-ary heaps of the priority queues against sorting, with insertions between deletions
+    {
+        mt19937 g(2021);
+        vector<int> keys(50000);
+        for (auto &key: keys) key = (int) (g() % 20000) - 10000;
+        auto test = [&keys](auto minPQ, auto maxPQ) {
+            vector<int> mins, maxs;
+            for (int i = 0; i < (int) keys.size(); i++) {
+                minPQ.insert(keys[i]);
+                maxPQ.insert(keys[i]);
+                if (i % 3 == 2) {
+                    int min = minPQ.min(), max = maxPQ.max();
+                    mins.push_back(minPQ.delMin());
+                    maxs.push_back(maxPQ.delMax());
+                    assert(mins.back() == min && maxs.back() == max);
+                }
+            }
+            assert(minPQ.size() == (int) (keys.size() - mins.size()));
+            while (!minPQ.isEmpty()) mins.push_back(minPQ.delMin());
+            while (!maxPQ.isEmpty()) maxs.push_back(maxPQ.delMax());
+
+            // the keys deleted between insertions are the minimum (maximum) of the keys inserted so far
+            vector<int> expectedMins, expectedMaxs;
+            MinPQ<int> referenceMin;
+            MaxPQ<int> referenceMax;
+            for (int i = 0; i < (int) keys.size(); i++) {
+                referenceMin.insert(keys[i]);
+                referenceMax.insert(keys[i]);
+                if (i % 3 == 2) {
+                    expectedMins.push_back(referenceMin.delMin());
+                    expectedMaxs.push_back(referenceMax.delMax());
+                }
+            }
+            while (!referenceMin.isEmpty()) expectedMins.push_back(referenceMin.delMin());
+            while (!referenceMax.isEmpty()) expectedMaxs.push_back(referenceMax.delMax());
+            assert(mins == expectedMins);
+            assert(maxs == expectedMaxs);
+        };
+        t0 = high_resolution_clock::now();
+        test(MinPQ<int, 4>(), MaxPQ<int, 4>());
+        test(MinPQ<int, 8>(), MaxPQ<int, 8>());
+        t1 = high_resolution_clock::now();
+
+        vector<string> words = {"it", "was", "the", "best", "of", "times", "it", "was", "the", "worst"};
+        MinPQ<string, 4> minWords{words};
+        MaxPQ<string, 8> maxWords{words};
+        assert(minWords.toString() == "best it it of the the times was was worst \n");
+        assert(maxWords.toString() == "worst was was times the the of it it best \n");
+
+        // empty and one-key heaps of every arity, built from a vector and printed
+        auto testSmall = [](auto minPQ, auto maxPQ) {
+            decltype(minPQ) emptyMin{vector<int>{}};
+            decltype(maxPQ) emptyMax{vector<int>{}};
+            assert(emptyMin.isEmpty() && emptyMax.isEmpty());
+            assert(minPQ.toString() == "\n" && maxPQ.toString() == "\n");
+            assert(emptyMin.toString() == "\n" && emptyMax.toString() == "\n");
+            decltype(minPQ) oneMin{vector<int>{7}};
+            decltype(maxPQ) oneMax{vector<int>{7}};
+            assert(oneMin.size() == 1 && oneMin.min() == 7 && oneMax.max() == 7);
+            assert(oneMin.toString() == "7 \n" && oneMax.toString() == "7 \n");
+        };
+        testSmall(MinPQ<int, 4>(), MaxPQ<int, 4>());
+        testSmall(MinPQ<int, 8>(), MaxPQ<int, 8>());
+
+        // NaNs compare false with every key, so the heap order is undefined, but a sink stays within the heap
+        auto testNaN = [](auto minPQ, auto maxPQ) {
+            for (int i = 0; i < 50; i++) {
+                double key = i % 3 == 0 ? nan("") : (double) (i * 7 % 50);
+                minPQ.insert(key);
+                maxPQ.insert(key);
+            }
+            while (!minPQ.isEmpty()) minPQ.delMin();
+            while (!maxPQ.isEmpty()) maxPQ.delMax();
+            assert(minPQ.size() == 0 && maxPQ.size() == 0);
+        };
+        testNaN(MinPQ<double, 4>(), MaxPQ<double, 4>());
+        testNaN(MinPQ<double, 8>(), MaxPQ<double, 8>());
+    }
+
+    cout << "Finished Testing d-ary Priority Queues: " << duration_cast<milliseconds>(t1 - t0).count() << " msecs\n"
+         << endl;
+
+    // Tests the batch insertions, popK and merge of the priority queues against sorting
+    {
+        mt19937 g(2021);
+        vector<int> keys(30000);
+        for (auto &key: keys) key = (int) (g() % 10000) - 5000;
+        auto test = [&keys](auto minPQ, auto maxPQ, auto otherMinPQ, auto otherMaxPQ) {
+            // small batches are swum, large ones heap-ordered bottom-up
+            int batches[] = {1, 7, 63, 64, 500, 4000};
+            int i = 0;
+            for (int b = 0; i < (int) keys.size(); b = (b + 1) % 6) {
+                int m = std::min(batches[b], (int) keys.size() - i);
+                span<const int> batch(keys.data() + i, m);
+                if (b % 2 == 0) {
+                    minPQ.insertBatch(batch);
+                    maxPQ.insertBatch(batch);
+                } else {
+                    otherMinPQ.insertBatch(batch);
+                    otherMaxPQ.insertBatch(batch);
+                }
+                i += m;
+            }
+            minPQ.merge(std::move(otherMinPQ));
+            maxPQ.merge(std::move(otherMaxPQ));
+            assert(otherMinPQ.isEmpty() && otherMaxPQ.isEmpty());
+            assert(minPQ.size() == (int) keys.size() && maxPQ.size() == (int) keys.size());
+
+            // popK in pieces of every size, including more than are left
+            vector<int> mins, maxs;
+            for (int k = 0; !minPQ.isEmpty(); k = k * 2 + 1) {
+                minPQ.popK(k, mins);
+                maxPQ.popK(k, maxs);
+                if (!minPQ.isEmpty() && !mins.empty()) assert(minPQ.min() >= mins.back() && maxPQ.max() <= maxs.back());
+            }
+            vector<int> sorted = keys;
+            sort(sorted.begin(), sorted.end());
+            assert(mins == sorted);
+            reverse(sorted.begin(), sorted.end());
+            assert(maxs == sorted);
+
+            // the merged-from priority queues are usable again
+            otherMinPQ.insertBatch(span<const int>(keys.data(), 100));
+            assert(otherMinPQ.size() == 100 && otherMinPQ.min() == *min_element(keys.begin(), keys.begin() + 100));
+        };
+        t0 = high_resolution_clock::now();
+        test(MinPQ<int>(), MaxPQ<int>(), MinPQ<int>(), MaxPQ<int>());
+        test(MinPQ<int, 4>(), MaxPQ<int, 4>(), MinPQ<int, 4>(), MaxPQ<int, 4>());
+        test(MinPQ<int, 8>(), MaxPQ<int, 8>(), MinPQ<int, 8>(), MaxPQ<int, 8>());
+        t1 = high_resolution_clock::now();
+
+        vector<string> words = {"it", "was", "the", "best", "of", "times", "it", "was", "the", "worst"};
+        MinPQ<string> minWords;
+        minWords.insertBatch(words);
+        vector<string> firstThree;
+        minWords.popK(3, firstThree);
+        assert(firstThree == vector<string>({"best", "it", "it"}));
+        assert(minWords.toString() == "of the the times was was worst \n");
+    }
+
+    cout << "Finished Testing Priority Queue Batches: " << duration_cast<milliseconds>(t1 - t0).count() << " msecs\n"
+         << endl;
+
+    // Tests the pairing heap and the radix heap against a binary heap, with insertions between deletions
+    {
+        mt19937 g(2021);
+        vector<int> keys(50000);
+        for (auto &key: keys) key = (int) (g() % 20000) - 10000;
+
+        t0 = high_resolution_clock::now();
+        PoolAllocator<int> arena;
+        PairingHeap<int> pairingHeap(arena), other(arena);
+        PairingHeap<int> separate;
+        MinPQ<int> reference;
+        for (int i = 0; i < (int) keys.size(); i++) {
+            reference.insert(keys[i]);
+            if (i % 5 == 1) other.insert(keys[i]);
+            else if (i % 5 == 3) separate.insert(keys[i]);
+            else pairingHeap.insert(keys[i]);
+            if (i % 1000 == 999) {
+                // melding from the same arena links the roots, from another one moves the keys
+                pairingHeap.meld(std::move(other));
+                pairingHeap.meld(std::move(separate));
+                assert(other.isEmpty() && separate.isEmpty());
+                assert(pairingHeap.size() == reference.size());
+                for (int j = 0; j < 100; j++) {
+                    int min = pairingHeap.min();
+                    assert(pairingHeap.delMin() == min && min == reference.delMin());
+                }
+            }
+        }
+        while (!reference.isEmpty()) assert(pairingHeap.delMin() == reference.delMin());
+        assert(pairingHeap.isEmpty());
+        bool threw = false;
+        try {
+            pairingHeap.delMin();
+        } catch (PairingHeap<int>::NoSuchElementException &) {
+            threw = true;
+        }
+        assert(threw);
+
+        // a timer hold: every deleted key is scheduled again later, so the keys are monotone
+        RadixHeap<unsigned> radixHeap;
+        MinPQ<unsigned> referenceTimers;
+        for (int key: keys) {
+            radixHeap.insert(key + 10000);
+            referenceTimers.insert(key + 10000);
+        }
+        for (int key: keys) {
+            unsigned time = radixHeap.min();
+            assert(radixHeap.delMin() == time && time == referenceTimers.delMin());
+            radixHeap.insert(time + (key + 10000) % 1000);
+            referenceTimers.insert(time + (key + 10000) % 1000);
+        }
+        while (!referenceTimers.isEmpty()) assert(radixHeap.delMin() == referenceTimers.delMin());
+        threw = false;
+        try {
+            radixHeap.insert(radixHeap.lastKey() - 1);
+        } catch (invalid_argument &) {
+            threw = true;
+        }
+        assert(threw);
+        t1 = high_resolution_clock::now();
+
+        // items with a key, as Dijkstra's algorithm keeps vertices by distance
+        auto distance = [](const pair<uint64_t, string> &item) { return item.first; };
+        RadixHeap<pair<uint64_t, string>, decltype(distance)> vertices(distance);
+        vertices.insert({7, "c"});
+        vertices.insert({0, "a"});
+        vertices.insert({3, "b"});
+        assert(vertices.delMin().second == "a");
+        vertices.insert({5, "d"});
+        assert(vertices.delMin().second == "b" && vertices.delMin().second == "d");
+        assert(vertices.toString() == "7 \n");
+
+        // peeking at the min deletes nothing, so a key below it but not below the last key deleted may still come
+        RadixHeap<unsigned> peeked;
+        peeked.insert(5);
+        peeked.insert(10);
+        assert(peeked.min() == 5 && peeked.lastKey() == 0);
+        peeked.insert(3);
+        assert(peeked.min() == 3 && peeked.delMin() == 3 && peeked.delMin() == 5 && peeked.delMin() == 10);
+
+        // the position of the min that a peek remembers follows the inserts and deletes that come after it
+        mt19937 peeks(2021);
+        MinPQ<unsigned> expected;
+        for (int i = 0; i < 20000; i++) {
+            if (peeks() % 3 != 0 || peeked.isEmpty()) {
+                unsigned key = peeked.lastKey() + peeks() % 1000;
+                peeked.insert(key);
+                expected.insert(key);
+            } else {
+                assert(peeked.delMin() == expected.delMin());
+            }
+            if (!peeked.isEmpty()) assert(peeked.min() == expected.min() && peeked.min() == expected.min());
+        }
+
+        PairingHeap<string> words;
+        for (const char *word: {"it", "was", "the", "best", "of", "times"}) words.insert(word);
+        assert(words.toString() == "best it of the times was \n");
+    }
+
+    cout << "Finished Testing Pairing and Radix Heaps: " << duration_cast<milliseconds>(t1 - t0).count() << " msecs\n"
+         << endl;
+
+    // Tests the concurrent priority queue: exact in the strict mode, within its rank error when relaxed,
+    // and losing no key when threads insert and delete at the same time
+    {
+        mt19937 g(2021);
+        vector<int> keys(5000);
+        for (auto &key: keys) key = (int) (g() % 100000);
+        vector<int> sorted = keys;
+        sort(sorted.begin(), sorted.end());
+
+        t0 = high_resolution_clock::now();
+        ConcurrentMinPQ<int> strict(4, ConcurrentMinPQMode::Strict);
+        for (int key: keys) strict.insert(key);
+        assert(strict.size() == (int) keys.size() && strict.min() == sorted[0]);
+        vector<int> deleted;
+        while (!strict.isEmpty()) deleted.push_back(strict.delMin());
+        assert(deleted == sorted);
+
+        // the rank of every deleted key among the keys left, with 8 shards
+        ConcurrentMinPQ<int> relaxed(4);
+        assert(relaxed.shardCount() == 8);
+        for (int key: keys) relaxed.insert(key);
+        vector<int> left = sorted;
+        long totalRank = 0;
+        int maxRank = 0;
+        while (!relaxed.isEmpty()) {
+            int key = relaxed.delMin();
+            auto it = lower_bound(left.begin(), left.end(), key);
+            assert(it != left.end() && *it == key);
+            int rank = (int) (it - left.begin());
+            totalRank += rank;
+            maxRank = std::max(maxRank, rank);
+            left.erase(it);
+        }
+        assert(left.empty());
+        assert(totalRank < 8L * (long) keys.size() && maxRank < 8 * 32);
+
+        bool threw = false;
+        try {
+            relaxed.delMin();
+        } catch (ConcurrentMinPQ<int>::NoSuchElementException &) {
+            threw = true;
+        }
+        assert(threw);
+
+        // four threads insert and delete at the same time, then the rest is drained
+        ConcurrentMinPQ<int> shared(4);
+        vector<vector<int>> taken(4);
+        vector<thread> threads;
+        for (int t = 0; t < 4; t++) {
+            threads.emplace_back([&shared, &keys, &taken, t] {
+                for (int i = t; i < (int) keys.size(); i += 4) {
+                    shared.insert(keys[i]);
+                    int key;
+                    if (i % 3 == 0 && shared.tryDelMin(key)) taken[t].push_back(key);
+                }
+            });
+        }
+        for (auto &thread: threads) thread.join();
+        vector<int> all;
+        for (auto &part: taken) all.insert(all.end(), part.begin(), part.end());
+        while (!shared.isEmpty()) all.push_back(shared.delMin());
+        sort(all.begin(), all.end());
+        assert(all == sorted);
+        t1 = high_resolution_clock::now();
+    }
+
+    cout << "Finished Testing Concurrent Priority Queue: " << duration_cast<milliseconds>(t1 - t0).count()
+         << " msecs\n" << endl;
+
+    // Tests the top-k of a stream against a sorted copy, offering keys one at a time, in batches,
+    // and into per-thread instances that are merged
+    {
+        mt19937 g(2021);
+        int n = 1000000, k = 100;
+        vector<int> keys(n);
+        for (int &key: keys) key = (int) (g() % 100000);
+        vector<int> largest = keys;
+        std::sort(largest.begin(), largest.end(), greater<int>());
+        largest.resize(k);
+
+        t0 = high_resolution_clock::now();
+        TopK<int> single(k);
+        for (int key: keys) single.offer(key);
+        assert(single.size() == k && single.keys() == largest && single.min() == largest.back());
+
+        TopK<int> batched(k);
+        for (int i = 0; i < n; i += 4096) batched.offerBatch(span<const int>(keys).subspan(i, min(4096, n - i)));
+        assert(batched.keys() == largest);
+
+        vector<TopK<int>> parts;
+        for (int t = 0; t < 4; t++) parts.emplace_back(k);
+        vector<thread> threads;
+        for (int t = 0; t < 4; t++)
+            threads.emplace_back([&parts, &keys, n, t] {
+                parts[t].offerBatch(span<const int>(keys).subspan(t * (n / 4), n / 4));
+            });
+        for (auto &thread: threads) thread.join();
+        for (int t = 1; t < 4; t++) parts[0].merge(std::move(parts[t]));
+        assert(parts[0].keys() == largest && parts[1].isEmpty());
+
+        TopK<int> few(k);
+        few.offerBatch(span<const int>(keys).first(10));
+        vector<int> first10(keys.begin(), keys.begin() + 10);
+        std::sort(first10.begin(), first10.end(), greater<int>());
+        assert(few.size() == 10 && few.keys() == first10);
+
+        // replacing the top of an empty priority queue throws an exception its caller can name
+        int thrown = 0;
+        try {
+            MinPQ<int, 4>().replaceMin(1);
+        } catch (const MinPQ<int, 4>::NoSuchElementException &e) {
+            thrown += string(e.what()) == "Priority Queue Underflow";
+        }
+        try {
+            MaxPQ<int, 4>().replaceMax(1);
+        } catch (const MaxPQ<int, 4>::NoSuchElementException &e) {
+            thrown += string(e.what()) == "Priority Queue Underflow";
+        }
+        assert(thrown == 2);
+        t1 = high_resolution_clock::now();
+    }
+
+    cout << "Finished Testing Top-K: " << duration_cast<milliseconds>(t1 - t0).count() << " msecs\n" << endl;
+
+    // Tests that the quantiles of a sketch, alone and merged from per-thread sketches, are within 2% in rank
+    // of the exact ones, and that the sketch stays small
+    {
+        mt19937 g(2021);
+        int n = 1000000;
+        vector<double> keys(n);
+        lognormal_distribution<double> latency(0, 1);
+        for (double &key: keys) key = latency(g);
+        vector<double> sorted = keys;
+        std::sort(sorted.begin(), sorted.end());
+        vector<double> qs = {0, 0.01, 0.25, 0.5, 0.9, 0.99, 0.999, 1};
+        auto check = [&](const QuantileSketch<double> &sketch) {
+            assert(sketch.count() == n);
+            vector<double> estimates = sketch.quantiles(qs);
+            for (int i = 0; i < (int) qs.size(); i++) {
+                long rank = lower_bound(sorted.begin(), sorted.end(), estimates[i]) - sorted.begin();
+                assert(abs(rank - qs[i] * n) <= 0.02 * n);
+            }
+            assert(estimates.front() == sorted.front() && estimates.back() == sorted.back());
+            assert(abs(sketch.rank(sorted[n / 2]) - n / 2) <= 0.02 * n);
+            assert(sketch.retained() < 3 * 200 + 64);
+        };
+
+        t0 = high_resolution_clock::now();
+        QuantileSketch<double> single(200, 2021);
+        single.insertBatch(keys);
+        check(single);
+
+        vector<QuantileSketch<double>> parts;
+        for (int t = 0; t < 4; t++) parts.emplace_back(200, 2021 + t);
+        vector<thread> threads;
+        for (int t = 0; t < 4; t++)
+            threads.emplace_back([&parts, &keys, n, t] {
+                for (int i = t * (n / 4); i < (t + 1) * (n / 4); i++) parts[t].insert(keys[i]);
+            });
+        for (auto &thread: threads) thread.join();
+        for (int t = 1; t < 4; t++) parts[0].merge(parts[t]);
+        check(parts[0]);
+        t1 = high_resolution_clock::now();
+
+        bool thrown = false;
+        try {
+            QuantileSketch<double>().quantile(0.5);
+        } catch (const QuantileSketch<double>::NoSuchElementException &) {
+            thrown = true;
+        }
+        assert(thrown);
+    }
+
+    cout << "Finished Testing Quantile Sketch: " << duration_cast<milliseconds>(t1 - t0).count() << " msecs\n"
+         << endl;
+
 }
 